@@ -5180,11 +5180,33 @@ class VariableState:
     """
     def __repr__(self) -> str:
         ...
+    def offload(self, file_path: str) -> None:
+        """
+                Pages the state content out to the file and releases the memory held by the state.
+                The file must not exist. The state is restored by restore() or by the next inference.
+                Supported by the KV cache states only.
+        
+                :param file_path: The path to the file to store the state content in.
+                :type file_path: str
+        """
     def reset(self) -> None:
         """
                 Reset internal variable state for relevant infer request,
                 to a value specified as default for according node.
         """
+    def restore(self) -> None:
+        """
+                Pages the state content offloaded by offload() back in.
+                Does nothing if the state is not offloaded.
+        """
+    def trim(self, length: int) -> None:
+        """
+                Truncates the state along its sequence axis to the given length in place.
+                Supported by the KV cache states only.
+        
+                :param length: The new length of the state, must not exceed the current one.
+                :type length: int
+        """
     @property
     def name(self) -> str:
         """
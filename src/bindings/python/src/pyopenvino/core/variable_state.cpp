@@ -26,6 +26,36 @@ void regclass_VariableState(py::module m) {
         to a value specified as default for according node.
     )");
 
+    variable_st.def("trim",
+                    &ov::VariableState::trim,
+                    py::arg("length"),
+                    R"(
+        Truncates the state along its sequence axis to the given length in place.
+        Supported by the KV cache states only.
+
+        :param length: The new length of the state, must not exceed the current one.
+        :type length: int
+    )");
+
+    variable_st.def("offload",
+                    &ov::VariableState::offload,
+                    py::arg("file_path"),
+                    R"(
+        Pages the state content out to the file and releases the memory held by the state.
+        The file must not exist. The state is restored by restore() or by the next inference.
+        Supported by the KV cache states only.
+
+        :param file_path: The path to the file to store the state content in.
+        :type file_path: str
+    )");
+
+    variable_st.def("restore",
+                    &ov::VariableState::restore,
+                    R"(
+        Pages the state content offloaded by offload() back in.
+        Does nothing if the state is not offloaded.
+    )");
+
     variable_st.def_property_readonly("name",
                                       &ov::VariableState::get_name,
                                       R"(
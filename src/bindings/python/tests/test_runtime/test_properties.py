@@ -176,6 +176,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (props.range_for_streams, "RANGE_FOR_STREAMS"),
         (props.optimal_batch_size, "OPTIMAL_BATCH_SIZE"),
         (props.max_batch_size, "MAX_BATCH_SIZE"),
+        (props.auto_batch_statistics, "AUTO_BATCH_STATISTICS"),
         (props.range_for_async_infer_requests, "RANGE_FOR_ASYNC_INFER_REQUESTS"),
         (props.execution_devices, "EXECUTION_DEVICES"),
         (props.loaded_from_cache, "LOADED_FROM_CACHE"),
@@ -243,6 +244,14 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (
+            props.auto_batch_latency_budget,
+            "AUTO_BATCH_LATENCY_BUDGET",
+            (
+                (21, 21),
+                (np.uint32(37), 37),
+            ),
+        ),
         (
             props.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -94,3 +94,23 @@ def test_query_state_write_buffer(device, base_class, input_shape, data_type, mo
             expected_res = np.full(input_shape, i, dtype=data_type)
 
         assert np.allclose(res[list(res)[0]], expected_res, atol=1e-6), f"Expected values: {expected_res} \n Actual values: {res} \n"
+
+
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") != "CPU",
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, the test checks the CPU states",
+)
+def test_variable_state_paging_not_supported(device):
+    core = Core()
+    model = generate_model_with_memory([10], np.float32)
+    request = core.compile_model(model=model, device_name=device).create_infer_request()
+    request.infer({0: np.ones([10], dtype=np.float32)})
+    mem_state = request.query_state()[0]
+
+    # only the KV cache states can be trimmed and offloaded, the other states are never offloaded
+    with pytest.raises(RuntimeError):
+        mem_state.trim(0)
+    with pytest.raises(RuntimeError):
+        mem_state.offload("state.bin")
+    mem_state.restore()
+    assert np.allclose(mem_state.state.data, np.ones([10], dtype=np.float32))
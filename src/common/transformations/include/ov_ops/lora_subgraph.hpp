@@ -19,6 +19,11 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): per batch row indices of the adapters. If present, `LoRA_matrices` hold
+ *    the stacked matrices of several adapters, and the body gathers the matrices of the selected adapter
+ *    for each row of `LoRA_input`, so that a single inference mixes the adapters. The gather copies the
+ *    matrices once per row, even for the rows sharing an adapter, so the adapter math is a batched MatMul
+ *    over the per-row copies rather than a segment-wise application of each unique adapter.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
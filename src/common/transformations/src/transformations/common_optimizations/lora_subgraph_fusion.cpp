@@ -15,6 +15,7 @@
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/pass/pattern/op/optional.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
@@ -30,15 +31,21 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
 
     auto read_value1_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert1_m = optional<ov::op::v0::Convert>(read_value1_m, consumers_count(1));
-    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, convert1_m}, consumers_count(1));
+    auto gather1_m = optional<ov::op::util::GatherBase>({convert1_m, any_input(), wrap_type<ov::op::v0::Constant>()},
+                                                        consumers_count(1));
+    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, gather1_m}, consumers_count(1));
 
     auto read_value2_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert2_m = optional<ov::op::v0::Convert>(read_value2_m, consumers_count(1));
-    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, convert2_m}, consumers_count(1));
+    auto gather2_m = optional<ov::op::util::GatherBase>({convert2_m, any_input(), wrap_type<ov::op::v0::Constant>()},
+                                                        consumers_count(1));
+    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, gather2_m}, consumers_count(1));
 
     auto read_value3_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert3_m = optional<ov::op::v0::Convert>(read_value3_m, consumers_count(1));
-    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, convert3_m}, consumers_count(1));
+    auto gather3_m = optional<ov::op::util::GatherBase>({convert3_m, any_input(), wrap_type<ov::op::v0::Constant>()},
+                                                        consumers_count(1));
+    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, gather3_m}, consumers_count(1));
 
     auto transpose_const2_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose2_m = optional<ov::op::v1::Transpose>({matmul2_m, transpose_const2_m}, consumers_count(1));
@@ -65,6 +72,28 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             return false;
         }
 
+        // Multi-adapter case: the states hold stacked LoRA matrices, and the matrices of the adapter
+        // selected for each batch row are gathered by the adapter indices shared by all the states
+        std::vector<std::shared_ptr<ov::op::util::GatherBase>> gathers;
+        for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+            if (pattern_map.count(gather_m)) {
+                const auto& gather = pattern_map.at(gather_m).get_node_shared_ptr();
+                gathers.push_back(ov::as_type_ptr<ov::op::util::GatherBase>(gather));
+            }
+        }
+        const bool is_batched = !gathers.empty();
+        if (is_batched) {
+            if (gathers.size() != 3) {
+                return false;
+            }
+            for (const auto& gather : gathers) {
+                if (gather->get_axis() != 0 || gather->get_batch_dims() != 0 ||
+                    gather->input_value(1) != gathers.front()->input_value(1)) {
+                    return false;
+                }
+            }
+        }
+
         auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
             for (size_t i = 0; i < child->get_input_size(); ++i) {
                 auto input = child->input(i);
@@ -80,11 +109,11 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             find_connected_input(add.get_node(), main_flow.get_node()),
             pattern_map.count(transpose1_m) ? pattern_map.at(transpose1_m).get_node()->input(0)
                                             : matmul1.get_node()->input(0),
-            matmul1.get_node()->input(1),
-            find_connected_input(multiply.get_node(), state_2.get_node()),
-            matmul2.get_node()->input(1),
+            is_batched ? gathers[0]->input(0) : matmul1.get_node()->input(1),
+            is_batched ? gathers[1]->input(0) : find_connected_input(multiply.get_node(), state_2.get_node()),
+            is_batched ? gathers[2]->input(0) : matmul2.get_node()->input(1),
         };
-        const ov::OutputVector external_connections{
+        ov::OutputVector external_connections{
             main_flow,
             lora_input,
             state_1,
@@ -99,6 +128,16 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             subgraph_parameters.push_back(new_parameter);
             in.replace_source_output(new_parameter);
         }
+        if (is_batched) {
+            const auto adapter_indices = gathers.front()->input_value(1);
+            auto new_parameter = std::make_shared<ov::op::v0::Parameter>(adapter_indices.get_element_type(),
+                                                                         adapter_indices.get_partial_shape());
+            subgraph_parameters.push_back(new_parameter);
+            for (const auto& gather : gathers) {
+                gather->input(1).replace_source_output(new_parameter);
+            }
+            external_connections.push_back(adapter_indices);
+        }
         // Note: lora consumers should be taken before lora_subgraph creation,
         // because only original consumers should be replaced with lora's output
         const auto& lora_consumers = add.get_target_inputs();
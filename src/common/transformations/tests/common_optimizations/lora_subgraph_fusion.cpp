@@ -12,6 +12,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -225,6 +226,69 @@ TEST_F(LoraSubgraphFusionMatMulTests, ReshaffledEltwiseInputs) {
     }
 }
 
+TEST_F(LoraSubgraphFusionMatMulTests, MultiAdapterPattern) {
+    const ov::PartialShape shape_stacked_1 = {-1, -1, K};
+    const ov::PartialShape shape_stacked_2 = {-1, 1, -1};
+    const ov::PartialShape shape_stacked_3 = {-1, N, -1};
+    auto gather_adapters = [](const ov::OutputVector& stacked, const ov::Output<ov::Node>& indices) {
+        ov::OutputVector gathered;
+        for (const auto& state : stacked) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            gathered.push_back(std::make_shared<ov::op::v8::Gather>(state, indices, axis));
+        }
+        return gathered;
+    };
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto states = create_states({shape_stacked_1, shape_stacked_2, shape_stacked_3});
+        auto lora_subgraph =
+            create_lora_subgraph(main_mm, param_lora, gather_adapters(states.first, param_idx), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        states.second,
+                                        ParameterVector{param_lora, param_w, param_idx});
+    }
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto inner_state_1 = std::make_shared<ov::op::v0::Parameter>(netType, shape_stacked_1);
+        auto inner_state_2 = std::make_shared<ov::op::v0::Parameter>(netType, shape_stacked_2);
+        auto inner_state_3 = std::make_shared<ov::op::v0::Parameter>(netType, shape_stacked_3);
+        auto inner_param_mm = std::make_shared<ov::op::v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_param_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        ov::OutputVector states_outs{inner_state_1, inner_state_2, inner_state_3};
+        auto inner_states = gather_adapters(states_outs, inner_param_idx);
+        auto lora_subgraph = create_lora_subgraph(inner_param_mm, inner_param_lora, inner_states, false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_state_1,
+                                         inner_state_2,
+                                         inner_state_3,
+                                         inner_param_idx};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        auto states = create_states({shape_stacked_1, shape_stacked_2, shape_stacked_3});
+        ov::OutputVector lora_inputs{main_mm, param_lora, states.first[0], states.first[1], states.first[2], param_idx};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            states.second,
+                                            ParameterVector{param_lora, param_w, param_idx});
+    }
+}
+
 class LoraSubgraphFusionConvolutionTests : public LoraSubgraphFusionTests {
 public:
     const ov::Dimension num_channels = 320;
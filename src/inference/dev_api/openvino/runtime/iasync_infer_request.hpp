@@ -11,6 +11,7 @@
 
 #include <future>
 #include <memory>
+#include <optional>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/exception.hpp"
@@ -71,6 +72,14 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Set scheduling hints of the next asynchronous inferences, which are passed to the executor of the first
+     * stage of the pipeline. The time the first stage waited in the executor queue is reported in the profiling info,
+     * if the synchronous request reports any.
+     * @param info - priority and deadline of the inference, std::nullopt returns to the unscheduled inferences
+     */
+    void set_scheduling_info(const std::optional<ov::threading::TaskSchedulingInfo>& info);
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -277,6 +286,9 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+    std::optional<ov::threading::TaskSchedulingInfo> m_scheduling_info;
+    ov::threading::TaskSchedulingInfo m_queue_wait_info;  //!< Scheduling hints of the last scheduled inference
+    std::optional<std::chrono::microseconds> m_queue_wait;  //!< Set only if the last inference was scheduled
 };
 
 }  // namespace ov
@@ -51,6 +51,23 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Truncates the state along its sequence axis to the given length without copying the state content
+     * @param length The new length of the state
+     */
+    virtual void trim(size_t length);
+
+    /**
+     * @brief Pages the state content out to the file and releases the memory occupied by it
+     * @param file_path The path to the file storing the state content until it is restored
+     */
+    virtual void offload(const std::string& file_path);
+
+    /**
+     * @brief Pages the offloaded state content back in, does nothing if the state is not offloaded
+     */
+    virtual void restore();
+
 protected:
     /**
      * @brief A default dtor
@@ -23,7 +23,10 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue or, with the
+ *        IStreamsExecutor::Config::TaskQueueType::WORK_STEALING, from the lock-free queue of each stream.
+ *        With the IStreamsExecutor::Config::TaskQueueType::PRIORITY, the single queue is ordered by the
+ *        scheduling hints passed to run_scheduled().
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -45,6 +48,8 @@ public:
 
     void run(Task task) override;
 
+    void run_scheduled(Task task, const TaskSchedulingInfo& info) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
@@ -76,6 +76,17 @@ public:
             THROUGHPUT,              //!< throughput mode
         };
 
+        /**
+         * @brief      This enum contains definition of the queue of the tasks submitted to the streams executor.
+         */
+        enum class TaskQueueType {
+            SHARED,         //!< Single queue shared by all the streams and protected by the mutex
+            WORK_STEALING,  //!< Lock-free queue per stream, an idle stream steals the tasks of the streams on the
+                            //!< same NUMA node
+            PRIORITY,       //!< Single queue ordered by the priority and the deadline of the tasks, the tasks waiting
+                            //!< too long run first
+        };
+
     private:
         std::string _name;             //!< Used by `ITT` to name executor threads
         int _streams = 1;              //!< Number of streams.
@@ -99,6 +110,7 @@ public:
         int _sub_streams = 0;
         std::vector<int> _rank = {};
         bool _add_lock = true;
+        TaskQueueType _task_queue_type = TaskQueueType::SHARED;
 
         /**
          * @brief Get and reserve cpu ids based on configuration and hardware information,
@@ -131,6 +143,7 @@ public:
          * @param[in]  cpu_pinning                  @copybrief Config::_cpu_pinning
          * @param[in]  streams_info_table           @copybrief Config::_streams_info_table
          * @param[in]  rank                         @copybrief Config::_rank
+         * @param[in]  task_queue_type              The queue of the tasks submitted to the executor
          */
         Config(std::string name = "StreamsExecutor",
                int streams = 1,
@@ -141,7 +154,8 @@ public:
                bool cores_limit = true,
                std::vector<std::vector<int>> streams_info_table = {},
                std::vector<int> rank = {},
-               bool add_lock = true)
+               bool add_lock = true,
+               TaskQueueType task_queue_type = TaskQueueType::SHARED)
             : _name{std::move(name)},
               _streams{streams},
               _threads_per_stream{threads_per_stream},
@@ -151,7 +165,8 @@ public:
               _cores_limit{cores_limit},
               _streams_info_table{std::move(streams_info_table)},
               _rank{std::move(rank)},
-              _add_lock(add_lock) {
+              _add_lock(add_lock),
+              _task_queue_type(task_queue_type) {
             update_executor_config(_add_lock);
         }
 
@@ -213,6 +228,9 @@ public:
         std::vector<int> get_rank() const {
             return _rank;
         }
+        TaskQueueType get_task_queue_type() const {
+            return _task_queue_type;
+        }
         StreamsMode get_sub_stream_mode() const {
             const auto proc_type_table = get_proc_type_table();
             int sockets = proc_type_table.size() > 1 ? static_cast<int>(proc_type_table.size()) - 1 : 1;
@@ -222,8 +240,8 @@ public:
         bool operator==(const Config& config) {
             if (_name == config._name && _streams == config._streams &&
                 _threads_per_stream == config._threads_per_stream &&
-                _thread_preferred_core_type == config._thread_preferred_core_type &&
-                _rank == config._rank) {
+                _thread_preferred_core_type == config._thread_preferred_core_type && _rank == config._rank &&
+                _task_queue_type == config._task_queue_type) {
                 return true;
             } else {
                 return false;
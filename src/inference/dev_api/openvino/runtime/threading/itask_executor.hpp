@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -16,6 +17,10 @@
 #include "openvino/runtime/common.hpp"
 
 namespace ov {
+namespace hint {
+enum class Priority;
+}  // namespace hint
+
 namespace threading {
 
 /**
@@ -25,6 +30,17 @@ namespace threading {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling hints of a task. The executors that do not schedule the tasks ignore them.
+ * @ingroup ov_dev_api_threading
+ */
+struct TaskSchedulingInfo {
+    //! The tasks with the higher priority run first, the default is ov::hint::Priority::MEDIUM
+    ov::hint::Priority priority = static_cast<ov::hint::Priority>(1);
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max();  //!< The tasks of the same priority run earliest deadline first
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ov_dev_api_threading
@@ -62,6 +78,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute ov::Task inside task executor context according to the scheduling hints.
+     *        Default run_scheduled() method implementation ignores the hints and uses run() pure virtual method
+     * @param task A task to start
+     * @param info Scheduling hints of the task
+     */
+    virtual void run_scheduled(Task task, const TaskSchedulingInfo& info);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default run_and_wait() method implementation uses run() pure virtual method
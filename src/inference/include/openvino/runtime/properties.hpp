@@ -451,6 +451,10 @@ inline std::istream& operator>>(std::istream& is, ModelDistributionPolicy& strea
  *                        sockets/devices process individual tensor one by one. And each socket/device processes a
  *                        portion of a different tensor in parallel.
  *
+ * With TENSOR_PARALLEL, the CPU plugin splits the key/value cache states of the attention by heads between the
+ * sockets. ov::InferRequest::query_state() still returns a single state per variable: ov::VariableState::get_state()
+ * gathers the heads of all the sockets, and ov::VariableState::set_state() expects all the heads and scatters them.
+ *
  * The following code is an example how TENSOR_PARALLEL or PIPELINE_PARALLEL model distribution policy might be enabled.
  *
  * @code
@@ -885,6 +889,25 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the latency budget (in ms) for the auto-batching. When it is non-zero, the timeout
+ * used to collect the inputs is adapted to the observed arrival rate of the requests and to the batched execution time,
+ * so that the collection and the execution of the batch fit the budget (and ov::auto_batch_timeout is not used).
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_budget{"AUTO_BATCH_LATENCY_BUDGET"};
+
+/**
+ * @brief Read-only property to get the statistics of the auto-batching for the compiled model:
+ *  - "TIMEOUT" is the timeout (in ms) currently used to collect the inputs (the average over the batched requests)
+ *  - "INFERENCES" is the number of the inferences executed on the device
+ *  - "REQUESTS" is the number of the requests executed by these inferences
+ *  - "BATCH_FILL" is the achieved fill of the batch by the requests (in percent)
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> auto_batch_statistics{
+    "AUTO_BATCH_STATISTICS"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -74,6 +74,29 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Truncates the state along its sequence axis to the given length in place, e.g. to drop the tokens of a
+     * KV cache rejected by speculative decoding. Unlike get_state/set_state, the state content is not copied.
+     * The operation is supported by the KV cache states only.
+     * @param length The new length of the state, must not exceed the current one.
+     */
+    void trim(size_t length);
+
+    /**
+     * @brief Pages the state content out to the file and releases the memory held by the state, e.g. to pause a
+     * chat session. The content is stored in the internal precision of the state, so a quantized KV cache stays
+     * quantized in the file. The state is restored from the memory mapped file by restore() or implicitly by the next
+     * inference, get_state() reads the file without restoring, reset() and set_state() discard the offloaded content.
+     * The file is removed once it is no longer needed. The operation is supported by the KV cache states only.
+     * @param file_path The path to the file to store the state content in.
+     */
+    void offload(const std::string& file_path);
+
+    /**
+     * @brief Pages the state content offloaded by offload() back in. Does nothing if the state is not offloaded.
+     */
+    void restore();
 };
 
 }  // namespace ov
@@ -49,4 +49,16 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::trim(size_t length) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->trim(length));
+}
+
+void VariableState::offload(const std::string& file_path) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->offload(file_path));
+}
+
+void VariableState::restore() {
+    OV_VARIABLE_CALL_STATEMENT(_impl->restore());
+}
+
 }  // namespace ov
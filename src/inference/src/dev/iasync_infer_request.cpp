@@ -4,8 +4,12 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <string>
 
+#include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
@@ -28,6 +32,17 @@ struct ImmediateStreamsExecutor : public ov::threading::ITaskExecutor {
     std::shared_ptr<ov::threading::IStreamsExecutor> _streamsExecutor;
 };
 
+bool is_profiling_enabled(const std::shared_ptr<const ov::ICompiledModel>& model) {
+    if (!model) {
+        return false;
+    }
+    const auto supported = model->get_property(ov::supported_properties.name()).as<std::vector<ov::PropertyName>>();
+    if (std::find(supported.begin(), supported.end(), ov::enable_profiling.name()) == supported.end()) {
+        return false;
+    }
+    return model->get_property(ov::enable_profiling.name()).as<bool>();
+}
+
 }  // namespace
 
 ov::IAsyncInferRequest::~IAsyncInferRequest() {
@@ -103,6 +118,12 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::move(callback);
 }
 
+void ov::IAsyncInferRequest::set_scheduling_info(const std::optional<ov::threading::TaskSchedulingInfo>& info) {
+    check_state();
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_scheduling_info = info;
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -121,7 +142,27 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    auto task = make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor));
+    std::optional<ov::threading::TaskSchedulingInfo> info;
+    if (itBeginStage == m_pipeline.begin()) {
+        // set_scheduling_info() may be called from another thread, so the hints are copied under the lock
+        std::lock_guard<std::mutex> lock{m_mutex};
+        info = m_scheduling_info;
+        m_queue_wait.reset();
+    }
+    if (info) {
+        m_queue_wait_info = *info;
+        const auto submitted = std::chrono::steady_clock::now();
+        firstStageExecutor->run_scheduled(
+            [this, submitted, task = std::move(task)] {
+                m_queue_wait =
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - submitted);
+                task();
+            },
+            *info);
+    } else {
+        firstStageExecutor->run(std::move(task));
+    }
 }
 
 ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
@@ -211,7 +252,18 @@ void ov::IAsyncInferRequest::check_cancelled_state() const {
 
 std::vector<ov::ProfilingInfo> ov::IAsyncInferRequest::get_profiling_info() const {
     check_state();
-    return m_sync_request->get_profiling_info();
+    auto perf = m_sync_request->get_profiling_info();
+    if (!perf.empty() && m_queue_wait && is_profiling_enabled(m_sync_request->get_compiled_model())) {
+        ov::ProfilingInfo info;
+        info.status = ov::ProfilingInfo::Status::EXECUTED;
+        info.node_name = "QueueWait";
+        info.node_type = "QueueWait";
+        info.exec_type = "priority_" + std::to_string(static_cast<int>(m_queue_wait_info.priority));
+        info.real_time = *m_queue_wait;
+        info.cpu_time = std::chrono::microseconds{0};
+        perf.emplace_back(std::move(info));
+    }
+    return perf;
 }
 
 ov::SoPtr<ov::ITensor> ov::IAsyncInferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
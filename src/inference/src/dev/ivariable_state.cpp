@@ -25,3 +25,15 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::trim(size_t) {
+    OPENVINO_NOT_IMPLEMENTED;
+}
+
+void ov::IVariableState::offload(const std::string&) {
+    OPENVINO_NOT_IMPLEMENTED;
+}
+
+void ov::IVariableState::restore() {
+    // the states without offload support are never offloaded
+}
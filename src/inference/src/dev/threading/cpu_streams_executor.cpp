@@ -5,12 +5,16 @@
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
 #include <thread>
+#include <tuple>
 #include <vector>
 
 #include "dev/threading/parallel_custom_arena.hpp"
@@ -228,6 +232,131 @@ struct CPUStreamsExecutor::Impl {
         int _ncpus = 0;
 #endif
     };
+    // Bounded lock-free multi-producer multi-consumer queue of the tasks (D. Vyukov's algorithm).
+    // The tasks are pushed by any thread, popped by the thread of the stream and stolen by the threads of other streams
+    class StreamTaskQueue {
+    public:
+        explicit StreamTaskQueue(size_t capacity) : _cells{new Cell[capacity]}, _mask{capacity - 1} {
+            OPENVINO_ASSERT(capacity && (capacity & _mask) == 0, "The capacity of the queue must be a power of two");
+            for (size_t i = 0; i < capacity; i++) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // the task is moved only if there is the room for it
+        bool try_push(Task& task) {
+            Cell* cell = nullptr;
+            auto pos = _enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                const auto diff = static_cast<std::ptrdiff_t>(cell->_sequence.load(std::memory_order_acquire) - pos);
+                if (diff == 0) {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->_task = std::move(task);
+            cell->_sequence.store(pos + 1, std::memory_order_release);
+            _size.fetch_add(1);
+            return true;
+        }
+
+        bool try_pop(Task& task) {
+            Cell* cell = nullptr;
+            auto pos = _dequeuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                const auto diff =
+                    static_cast<std::ptrdiff_t>(cell->_sequence.load(std::memory_order_acquire) - (pos + 1));
+                if (diff == 0) {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            task = std::move(cell->_task);
+            cell->_task = nullptr;
+            cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+            _size.fetch_sub(1);
+            return true;
+        }
+
+        // the number of the pushed tasks that are not popped yet (may be negative for a moment)
+        std::ptrdiff_t size() const {
+            return _size.load();
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> _sequence;
+            Task _task;
+        };
+        std::unique_ptr<Cell[]> _cells;
+        const size_t _mask;
+        alignas(64) std::atomic<size_t> _enqueuePos{0};
+        alignas(64) std::atomic<size_t> _dequeuePos{0};
+        alignas(64) std::atomic<std::ptrdiff_t> _size{0};
+    };
+
+    // The thread of the stream with its own queue of the tasks, used by the TaskQueueType::WORK_STEALING
+    struct StreamWorker {
+        StreamTaskQueue _queue{1024};
+        // -1 is a valid id of the NUMA node, which is returned when the topology is unknown
+        static constexpr int unknownNumaNodeId = std::numeric_limits<int>::min();
+        // NUMA node of the stream, set when the thread of the stream starts
+        std::atomic<int> _numaNodeId{unknownNumaNodeId};
+        std::atomic<bool> _sleeping{false};
+        std::mutex _mutex;
+        std::condition_variable _queueCondVar;
+    };
+
+    // Queue of the tasks used by the TaskQueueType::PRIORITY. The tasks run in the order of the priority, then of the
+    // deadline, then of the submission. A task waiting longer than the starvation limit runs before all others, so the
+    // low priority tasks still progress under the constant load of the high priority ones.
+    class ScheduledTaskQueue {
+    public:
+        void push(Task task, const TaskSchedulingInfo& info) {
+            const Key key{-static_cast<int>(info.priority), info.deadline, _sequence++};
+            _submissions.emplace(std::get<2>(key), std::make_pair(std::chrono::steady_clock::now(), key));
+            _tasks.emplace(key, std::move(task));
+        }
+
+        Task pop() {
+            auto key = _tasks.begin()->first;
+            const auto& oldest = _submissions.begin()->second;
+            if (std::chrono::steady_clock::now() - oldest.first > starvation_limit) {
+                key = oldest.second;
+            }
+            auto it = _tasks.find(key);
+            auto task = std::move(it->second);
+            _tasks.erase(it);
+            _submissions.erase(std::get<2>(key));
+            return task;
+        }
+
+        bool empty() const {
+            return _tasks.empty();
+        }
+
+        static constexpr std::chrono::milliseconds starvation_limit{100};
+
+    private:
+        // the negated priority, the deadline and the submission number
+        using Key = std::tuple<int, std::chrono::steady_clock::time_point, uint64_t>;
+        std::map<Key, Task> _tasks;
+        std::map<uint64_t, std::pair<std::chrono::steady_clock::time_point, Key>> _submissions;
+        uint64_t _sequence = 0;
+    };
+
     // if the thread is created by CPUStreamsExecutor, the Impl::Stream of the thread is stored by tbb Class
     // enumerable_thread_specific, the alias is ThreadLocal, the limitations of ThreadLocal please refer to
     // https://spec.oneapi.io/versions/latest/elements/oneTBB/source/thread_local_storage/enumerable_thread_specific_cls.html
@@ -371,11 +500,28 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        if (_config.get_task_queue_type() == Config::TaskQueueType::WORK_STEALING) {
+            for (auto streamId = 0; streamId < streams_num; ++streamId) {
+                _workers.emplace_back(new StreamWorker);
+            }
+        }
+        // the workers create their streams on start, which needs the thread ids map to be complete
+        std::unique_lock<std::mutex> startLock(_mutex, std::defer_lock);
+        if (!_workers.empty()) {
+            startLock.lock();
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            if (_config.get_task_queue_type() == Config::TaskQueueType::WORK_STEALING) {
+                _threads.emplace_back([this, streamId] {
+                    openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                    RunWorker(streamId);
+                });
+                continue;
+            }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
@@ -383,9 +529,11 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return !_taskQueue.empty() || !_scheduledTasks.empty() || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
+                        if (!_scheduledTasks.empty()) {
+                            task = _scheduledTasks.pop();
+                        } else if (!_taskQueue.empty()) {
                             task = std::move(_taskQueue.front());
                             _taskQueue.pop();
                         }
@@ -400,6 +548,14 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        if (!_workers.empty()) {
+            EnqueueToWorker(std::move(task));
+            return;
+        }
+        if (_config.get_task_queue_type() == Config::TaskQueueType::PRIORITY) {
+            EnqueueScheduled(std::move(task), {});
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -407,6 +563,122 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void EnqueueScheduled(Task task, const TaskSchedulingInfo& info) {
+        if (_config.get_task_queue_type() != Config::TaskQueueType::PRIORITY) {
+            Enqueue(std::move(task));
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _scheduledTasks.push(std::move(task), info);
+        }
+        _queueCondVar.notify_one();
+    }
+
+    void EnqueueToWorker(Task task) {
+        const auto first = _nextWorker.fetch_add(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < _workers.size(); i++) {
+            auto& worker = *_workers[(first + i) % _workers.size()];
+            if (!worker._queue.try_push(task)) {
+                continue;
+            }
+            if (worker._sleeping) {
+                WakeUp(worker);
+                return;
+            }
+            // the stream is busy, so another stream of the same NUMA node is woken up to steal the task
+            const auto numaNodeId = worker._numaNodeId.load();
+            for (auto& other : _workers) {
+                if (other.get() != &worker && other->_sleeping && numaNodeId != StreamWorker::unknownNumaNodeId &&
+                    other->_numaNodeId == numaNodeId) {
+                    WakeUp(*other);
+                    return;
+                }
+            }
+            return;
+        }
+        // all the queues are full, so the task goes to the shared queue checked by all the streams
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+            _sharedQueueSize++;
+        }
+        for (auto& worker : _workers) {
+            WakeUp(*worker);
+        }
+    }
+
+    static void WakeUp(StreamWorker& worker) {
+        // the worker checks the queues under the mutex before waiting, so the notification is not lost
+        { std::lock_guard<std::mutex> lock(worker._mutex); }
+        worker._queueCondVar.notify_one();
+    }
+
+    bool HasTasks(const StreamWorker& worker) const {
+        if (worker._queue.size() > 0 || _sharedQueueSize > 0) {
+            return true;
+        }
+        const auto numaNodeId = worker._numaNodeId.load();
+        for (auto& other : _workers) {
+            if (numaNodeId != StreamWorker::unknownNumaNodeId && other->_numaNodeId == numaNodeId &&
+                other->_queue.size() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool PopTask(size_t workerId, Task& task) {
+        auto& worker = *_workers[workerId];
+        if (worker._queue.try_pop(task)) {
+            return true;
+        }
+        // steal from the streams on the same NUMA node, starting from the next one to spread the thieves
+        const auto numaNodeId = worker._numaNodeId.load();
+        if (numaNodeId != StreamWorker::unknownNumaNodeId) {
+            for (size_t i = 1; i < _workers.size(); i++) {
+                auto& other = *_workers[(workerId + i) % _workers.size()];
+                if (other._numaNodeId == numaNodeId && other._queue.try_pop(task)) {
+                    return true;
+                }
+            }
+        }
+        if (_sharedQueueSize > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _sharedQueueSize--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RunWorker(size_t workerId) {
+        auto& worker = *_workers[workerId];
+        // the stream is created before the first task, so the tasks can be stolen by the streams of its NUMA node
+        // from the start
+        { std::lock_guard<std::mutex> lock(_mutex); }
+        worker._numaNodeId = _streams.local()->_numaNodeId;
+        for (;;) {
+            Task task;
+            if (PopTask(workerId, task)) {
+                Execute(task, *(_streams.local()));
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(worker._mutex);
+            worker._sleeping = true;
+            worker._queueCondVar.wait(lock, [&] {
+                return HasTasks(worker) || _isStopped;
+            });
+            worker._sleeping = false;
+            if (_isStopped && !HasTasks(worker)) {
+                break;
+            }
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -475,7 +747,11 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    ScheduledTaskQueue _scheduledTasks;
+    std::atomic<bool> _isStopped{false};
+    std::vector<std::unique_ptr<StreamWorker>> _workers;
+    std::atomic<size_t> _nextWorker{0};
+    std::atomic<size_t> _sharedQueueSize{0};
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
     std::shared_ptr<ExecutorManager> _exectorMgr;
@@ -535,6 +811,9 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    for (auto& worker : _impl->_workers) {
+        _impl->WakeUp(*worker);
+    }
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -554,5 +833,13 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_scheduled(Task task, const TaskSchedulingInfo& info) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->EnqueueScheduled(std::move(task), info);
+    }
+}
+
 }  // namespace threading
 }  // namespace ov
@@ -9,9 +9,18 @@
 #include <utility>
 #include <vector>
 
+#include "openvino/runtime/properties.hpp"
+
 namespace ov {
 namespace threading {
 
+static_assert(TaskSchedulingInfo{}.priority == ov::hint::Priority::MEDIUM,
+              "The tasks are scheduled with the medium priority by default");
+
+void ITaskExecutor::run_scheduled(Task task, const TaskSchedulingInfo&) {
+    run(std::move(task));
+}
+
 void ITaskExecutor::run_and_wait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
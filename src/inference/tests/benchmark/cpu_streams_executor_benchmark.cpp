@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Micro-benchmark of the CPUStreamsExecutor task queues on the many small tasks.
+//
+// The tasks are submitted by several producer threads at once, as the asynchronous inference requests of a server do,
+// and every task only spins for the given time, so the measured throughput is bound by the queue of the executor.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+
+struct BenchmarkOptions {
+    size_t streams = 0;
+    size_t producers = 4;
+    size_t tasks = 1000000;
+    size_t task_us = 0;
+    size_t warmup = 1;
+    size_t iterations = 5;
+};
+
+void print_help() {
+    std::cout << "Usage: ov_cpu_streams_executor_benchmark [--option=value ...]\n"
+                 "  --streams=0                    streams number, 0 is the number of the CPU cores\n"
+                 "  --producers=4                  threads submitting the tasks\n"
+                 "  --tasks=1000000                tasks number of an iteration\n"
+                 "  --task_us=0                    busy time of a task, in microseconds\n"
+                 "  --warmup=1 --iterations=5\n";
+}
+
+BenchmarkOptions parse_options(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const auto eq = arg.find('=');
+        const auto key = arg.substr(0, eq);
+        const auto value = eq == std::string::npos ? std::string{} : arg.substr(eq + 1);
+        auto as_size = [&]() {
+            return static_cast<size_t>(std::stoull(value));
+        };
+        if (key == "--help" || key == "-h") {
+            print_help();
+            std::exit(EXIT_SUCCESS);
+        } else if (key == "--streams") {
+            options.streams = as_size();
+        } else if (key == "--producers") {
+            options.producers = as_size();
+        } else if (key == "--tasks") {
+            options.tasks = as_size();
+        } else if (key == "--task_us") {
+            options.task_us = as_size();
+        } else if (key == "--warmup") {
+            options.warmup = as_size();
+        } else if (key == "--iterations") {
+            options.iterations = as_size();
+        } else {
+            OPENVINO_THROW("Unknown option: ", arg);
+        }
+    }
+    if (options.streams == 0) {
+        options.streams = static_cast<size_t>(ov::get_number_of_cpu_cores());
+    }
+    OPENVINO_ASSERT(options.producers > 0, "producers must be positive");
+    OPENVINO_ASSERT(options.tasks >= options.producers, "tasks must not be less than producers");
+    OPENVINO_ASSERT(options.iterations > 0, "iterations must be positive");
+    return options;
+}
+
+void spin(size_t us) {
+    const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+// returns the time to execute all the tasks, in seconds
+double run_iteration(const BenchmarkOptions& options, CPUStreamsExecutor& executor) {
+    std::atomic<size_t> remaining{options.tasks};
+    std::promise<void> done;
+    auto task = [&]() {
+        spin(options.task_us);
+        if (remaining.fetch_sub(1) == 1) {
+            done.set_value();
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < options.producers; p++) {
+        const auto count = options.tasks / options.producers + (p < options.tasks % options.producers ? 1 : 0);
+        producers.emplace_back([&, count]() {
+            for (size_t i = 0; i < count; i++) {
+                executor.run(task);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    done.get_future().wait();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void run_config(const BenchmarkOptions& options, IStreamsExecutor::Config::TaskQueueType queue_type) {
+    const auto* name = queue_type == IStreamsExecutor::Config::TaskQueueType::SHARED ? "shared" : "work_stealing";
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"StreamsExecutorBenchmark",
+                                                         static_cast<int>(options.streams),
+                                                         1,
+                                                         ov::hint::SchedulingCoreType::ANY_CORE,
+                                                         false,
+                                                         false,
+                                                         true,
+                                                         {},
+                                                         {},
+                                                         true,
+                                                         queue_type}};
+    for (size_t i = 0; i < options.warmup; i++) {
+        run_iteration(options, executor);
+    }
+    double total = 0;
+    for (size_t i = 0; i < options.iterations; i++) {
+        total += run_iteration(options, executor);
+    }
+    const auto seconds = total / options.iterations;
+    std::cout << std::left << std::setw(16) << name << " streams " << options.streams << ", producers "
+              << options.producers << ": " << std::fixed << std::setprecision(3) << seconds * 1000 << " ms, "
+              << std::setprecision(0) << options.tasks / seconds << " tasks/s" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        const auto options = parse_options(argc, argv);
+        run_config(options, IStreamsExecutor::Config::TaskQueueType::SHARED);
+        run_config(options, IStreamsExecutor::Config::TaskQueueType::WORK_STEALING);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -215,6 +215,124 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorWorkStealingTests, taskQueuedToBlockedStreamRunsOnAnotherStream) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                 2,
+                                 1,
+                                 ov::hint::SchedulingCoreType::ANY_CORE,
+                                 false,
+                                 false,
+                                 true,
+                                 {},
+                                 {},
+                                 true,
+                                 IStreamsExecutor::Config::TaskQueueType::WORK_STEALING});
+    std::promise<int> blocked_stream;
+    std::promise<void> unblock;
+    auto blocked = unblock.get_future().share();
+    executor->run([&] {
+        blocked_stream.set_value(executor->get_stream_id());
+        blocked.wait();
+    });
+    auto blocked_stream_id = blocked_stream.get_future().get();
+
+    // the tasks are queued to the streams in turn, so one of them goes to the queue of the blocked stream
+    std::vector<std::promise<int>> tasks(2);
+    std::vector<std::future<int>> stream_ids;
+    for (auto& task : tasks) {
+        stream_ids.push_back(task.get_future());
+        executor->run([&] {
+            task.set_value(executor->get_stream_id());
+        });
+    }
+    std::vector<std::future_status> statuses;
+    for (auto& stream_id : stream_ids) {
+        statuses.push_back(stream_id.wait_for(std::chrono::seconds{10}));
+    }
+    unblock.set_value();
+    for (size_t i = 0; i < tasks.size(); i++) {
+        ASSERT_EQ(statuses[i], std::future_status::ready);
+        ASSERT_NE(stream_ids[i].get(), blocked_stream_id);
+    }
+}
+
+static std::shared_ptr<CPUStreamsExecutor> make_single_stream_priority_executor() {
+    return std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                 1,
+                                 1,
+                                 ov::hint::SchedulingCoreType::ANY_CORE,
+                                 false,
+                                 false,
+                                 true,
+                                 {},
+                                 {},
+                                 true,
+                                 IStreamsExecutor::Config::TaskQueueType::PRIORITY});
+}
+
+// the single stream is blocked until all the tasks are submitted, so the queue decides the order of the tasks
+static std::vector<int> run_blocked(const std::shared_ptr<CPUStreamsExecutor>& executor,
+                                    const std::vector<std::pair<TaskSchedulingInfo, int>>& tasks,
+                                    std::chrono::milliseconds first_task_wait = std::chrono::milliseconds{0}) {
+    std::promise<void> started;
+    std::promise<void> unblock;
+    auto blocked = unblock.get_future().share();
+    executor->run([&started, blocked] {
+        started.set_value();
+        blocked.wait();
+    });
+    started.get_future().wait();
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    for (const auto& task : tasks) {
+        auto promise = std::make_shared<std::promise<void>>();
+        futures.emplace_back(promise->get_future());
+        executor->run_scheduled(
+            [&, promise, id = task.second] {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    order.push_back(id);
+                }
+                promise->set_value();
+            },
+            task.first);
+        if (futures.size() == 1) {
+            std::this_thread::sleep_for(first_task_wait);
+        }
+    }
+    unblock.set_value();
+    for (auto& future : futures) {
+        future.wait();
+    }
+    return order;
+}
+
+TEST(CPUStreamsExecutorPriorityTests, tasksRunByPriorityThenDeadline) {
+    const auto now = std::chrono::steady_clock::now();
+    TaskSchedulingInfo low{ov::hint::Priority::LOW};
+    TaskSchedulingInfo medium{ov::hint::Priority::MEDIUM};
+    TaskSchedulingInfo medium_late{ov::hint::Priority::MEDIUM, now + std::chrono::seconds{20}};
+    TaskSchedulingInfo medium_early{ov::hint::Priority::MEDIUM, now + std::chrono::seconds{10}};
+    TaskSchedulingInfo high{ov::hint::Priority::HIGH};
+    auto order =
+        run_blocked(make_single_stream_priority_executor(),
+                    {{low, 0}, {medium, 1}, {medium_late, 2}, {medium_early, 3}, {high, 4}, {medium, 5}});
+    ASSERT_EQ(order, (std::vector<int>{4, 3, 2, 1, 5, 0}));
+}
+
+TEST(CPUStreamsExecutorPriorityTests, starvingTaskRunsFirst) {
+    TaskSchedulingInfo low{ov::hint::Priority::LOW};
+    TaskSchedulingInfo high{ov::hint::Priority::HIGH};
+    // the low priority task waits for longer than the starvation limit before the high priority ones are submitted
+    auto order = run_blocked(make_single_stream_priority_executor(),
+                             {{low, 0}, {high, 1}, {high, 2}},
+                             std::chrono::milliseconds{150});
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -236,6 +354,38 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
     },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                     streams,
+                                     threads / streams,
+                                     ov::hint::SchedulingCoreType::ANY_CORE,
+                                     false,
+                                     false,
+                                     true,
+                                     {},
+                                     {},
+                                     true,
+                                     IStreamsExecutor::Config::TaskQueueType::WORK_STEALING});
+    },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                     streams,
+                                     threads / streams,
+                                     ov::hint::SchedulingCoreType::ANY_CORE,
+                                     false,
+                                     false,
+                                     true,
+                                     {},
+                                     {},
+                                     true,
+                                     IStreamsExecutor::Config::TaskQueueType::PRIORITY});
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -260,6 +410,22 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+    },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                     streams,
+                                     threads / streams,
+                                     ov::hint::SchedulingCoreType::ANY_CORE,
+                                     false,
+                                     false,
+                                     true,
+                                     {},
+                                     {},
+                                     true,
+                                     IStreamsExecutor::Config::TaskQueueType::WORK_STEALING});
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
@@ -62,15 +62,21 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
             explicit ThisRequestExecutor(AsyncInferRequest* _this_) : _this{_this_} {}
             void run(ov::threading::Task task) override {
                 auto workerInferRequest = _this->m_sync_request->m_batched_request_wrapper;
+                workerInferRequest->register_arrival();
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
+                // notified under the mutex, as the idle worker waits without the timeout and must not miss it
+                std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
+                } else if (workerInferRequest->_is_idle) {
+                    // the first request starts the timeout to collect the batch
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
@@ -84,7 +90,9 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                      std::rethrow_exception(batchReq->_exception_ptr);
                  // in the case of non-batched execution the tensors were set explicitly
                  if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
-                     this->m_sync_request->m_batched_request_status) {
+                         this->m_sync_request->m_batched_request_status ||
+                     SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED ==
+                         this->m_sync_request->m_batched_request_status) {
                      this->m_sync_request->copy_outputs_if_needed();
                  }
              }}};
@@ -110,15 +118,22 @@ void AsyncInferRequest::set_tensors(const ov::Output<const ov::Node>& port,
 
 std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
-        return m_sync_request->get_profiling_info();
+    std::vector<ov::ProfilingInfo> info;
+    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status ||
+        SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        info = m_sync_request->get_profiling_info();
     else
-        return m_request_without_batch->get_profiling_info();
+        info = m_request_without_batch->get_profiling_info();
+    // the device reports the profiling info only when the profiling is enabled
+    if (!info.empty() && m_sync_request->has_copies())
+        info.push_back(m_sync_request->get_copy_profiling_info());
+    return info;
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status ||
+        SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
     else
         return m_request_without_batch->query_state();
@@ -17,26 +17,69 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::function<ov::SoPtr<ov::ICompiledModel>(int)>& compile_model_with_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compile_model_with_partial_batch(compile_model_with_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_budget = config.find(ov::auto_batch_latency_budget.name());
+    if (latency_budget != config.end())
+        m_latency_budget = latency_budget->second.as<std::uint32_t>();
+}
+
+void CompiledModel::WorkerInferRequest::register_arrival(std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    if (_last_arrival != std::chrono::steady_clock::time_point{}) {
+        const double inter_arrival_ms = std::chrono::duration<double, std::milli>(now - _last_arrival).count();
+        _inter_arrival_ms += (inter_arrival_ms - _inter_arrival_ms) / 8;
+    }
+    _last_arrival = now;
+}
+
+void CompiledModel::WorkerInferRequest::register_execution(int num_requests) {
+    _num_inferences++;
+    _num_requests += num_requests;
+}
+
+void CompiledModel::WorkerInferRequest::register_batch_execution_time(std::chrono::steady_clock::duration time) {
+    const double execution_ms = std::chrono::duration<double, std::milli>(time).count();
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    _batch_execution_ms =
+        _batch_execution_ms == 0 ? execution_ms : _batch_execution_ms + (execution_ms - _batch_execution_ms) / 8;
+}
+
+std::uint32_t CompiledModel::WorkerInferRequest::adapt_timeout(std::uint32_t latency_budget) {
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    // the time left to collect the batch, so that the collection and the execution of the batch fit the budget
+    const double max_timeout = std::max(0.0, latency_budget - _batch_execution_ms);
+    // waiting makes sense only if more requests are expected to arrive by the timeout (the full batch wakes up the
+    // worker immediately anyway), otherwise the collected requests are executed with the minimal delay
+    const double timeout = _inter_arrival_ms <= max_timeout ? max_timeout : 0.0;
+    return std::max<std::uint32_t>(1, static_cast<std::uint32_t>(timeout));
 }
 
 CompiledModel::~CompiledModel() {
     m_terminate = true;
     for (const auto& w : m_worker_requests) {
+        {
+            // wakes up the idle worker, which waits without the timeout
+            std::lock_guard<std::mutex> lock(w->_mutex);
+            w->_cond.notify_all();
+        }
         w->_thread.join();
     }
     m_worker_requests.clear();
+    // the workers are joined, so none of them starts the compilation of the smaller batches concurrently
+    WaitPartialBatchCompilation();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
@@ -69,6 +112,8 @@ CompiledModel::GetWorkerInferRequest() const {
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->register_batch_execution_time(std::chrono::steady_clock::now() -
+                                                                workerRequestPtr->_batch_execution_start);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +129,21 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    // nothing to collect, so sleep till the first request arrives (and starts the timeout) rather
+                    // than waking up by the timeout
+                    workerRequestPtr->_is_idle = true;
+                    workerRequestPtr->_cond.wait(lock, [workerRequestPtr, this] {
+                        return m_terminate || workerRequestPtr->_tasks.size() != 0;
+                    });
+                    workerRequestPtr->_is_idle = false;
+                    const std::uint32_t latency_budget = m_latency_budget;
+                    const std::uint32_t time_out =
+                        latency_budget ? workerRequestPtr->adapt_timeout(latency_budget) : m_time_out.load();
+                    workerRequestPtr->_timeout = time_out;
+                    // the full batch may have arrived with the first request
+                    status = workerRequestPtr->_is_wakeup
+                                 ? std::cv_status::no_timeout
+                                 : workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(time_out));
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -104,7 +163,14 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->register_execution(sz);
+                        workerRequestPtr->_batch_execution_start = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
+                    } else if ((status == std::cv_status::timeout) && sz > 1 &&
+                               PreparePartialBatchRequests(*workerRequestPtr)) {
+                        // timeout to collect the batch is over, execute the collected requests in the smaller batches
+                        ExecutePartialBatch(*workerRequestPtr, sz);
+                        // now when all the tasks for this batch are completed, start waiting for the timeout again
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
@@ -129,6 +195,8 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
+                        for (int n = 0; n < sz; n++)
+                            workerRequestPtr->register_execution(1);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -138,6 +206,80 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+bool CompiledModel::PreparePartialBatchRequests(WorkerInferRequest& worker_request) const {
+    if (!m_compile_model_with_partial_batch)
+        return false;
+    std::call_once(m_partial_batch_compilation_started, [this] {
+        m_partial_batch_compilation = std::async(std::launch::async, [this] {
+            for (int batch_size = m_device_info.device_batch_size / 2; batch_size > 1 && !m_terminate;
+                 batch_size /= 2) {
+                try {
+                    m_compiled_models_with_partial_batch[batch_size] = m_compile_model_with_partial_batch(batch_size);
+                } catch (const ov::Exception&) {
+                    break;
+                }
+            }
+            m_partial_batch_compiled = true;
+        });
+    });
+    if (!m_partial_batch_compiled)
+        return false;
+    auto& requests = worker_request._infer_requests_partial_batch;
+    if (requests.size() != m_compiled_models_with_partial_batch.size()) {
+        for (const auto& compiled_model : m_compiled_models_with_partial_batch) {
+            auto& request = requests[compiled_model.first];
+            request._ptr = compiled_model.second->create_infer_request();
+            if (request._so == nullptr)
+                request._so = compiled_model.second._so;
+        }
+    }
+    return !requests.empty();
+}
+
+void CompiledModel::WaitPartialBatchCompilation() const {
+    if (m_partial_batch_compilation.valid())
+        m_partial_batch_compilation.wait();
+}
+
+void CompiledModel::ExecutePartialBatch(WorkerInferRequest& worker_request, int num_tasks) {
+    auto& requests = worker_request._infer_requests_partial_batch;
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(num_tasks);
+    for (int n = 0; n < num_tasks; n++) {
+        OPENVINO_ASSERT(worker_request._tasks.try_pop(tasks[n]));
+    }
+    // the collected requests are executed with the largest of the smaller batches, while the rest of them
+    // with the smallest batch that fits (the remaining slots of the batch are just padding)
+    for (int first = 0; first < num_tasks;) {
+        auto partial = requests.lower_bound(num_tasks - first);
+        if (partial == requests.end())
+            partial = std::prev(requests.end());
+        const int num_batched = std::min(partial->first, num_tasks - first);
+        std::exception_ptr exception_ptr;
+        try {
+            for (int n = 0; n < num_batched; n++) {
+                auto& sync_request = tasks[first + n].first->m_sync_request;
+                sync_request->m_infer_request_partial_batch = partial->second;
+                sync_request->m_partial_batch_id = n;
+                sync_request->m_partial_batch_size = partial->first;
+                sync_request->m_batched_request_status =
+                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                sync_request->copy_inputs_if_needed();
+            }
+            // the callbacks are not called for the synchronous inference, so the tasks are completed here
+            partial->second->infer();
+            worker_request.register_execution(num_batched);
+        } catch (...) {
+            exception_ptr = std::current_exception();
+        }
+        for (int n = 0; n < num_batched; n++) {
+            if (exception_ptr)
+                tasks[first + n].first->m_sync_request->m_exception_ptr = exception_ptr;
+            tasks[first + n].second();
+        }
+        first += num_batched;
+    }
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -170,11 +312,16 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_budget.name()) {
+            m_latency_budget = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch_latency_budget.name()] = property.second.as<std::uint32_t>();
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_latency_budget.name());
         }
     }
 }
@@ -212,10 +359,33 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_budget.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_statistics.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_budget) {
+            uint32_t latency_budget = m_latency_budget;
+            return latency_budget;
+        } else if (name == ov::auto_batch_statistics) {
+            uint64_t timeout = 0, num_inferences = 0, num_requests = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+                for (const auto& worker : m_worker_requests) {
+                    timeout += worker->_timeout;
+                    num_inferences += worker->_num_inferences;
+                    num_requests += worker->_num_requests;
+                }
+                if (!m_worker_requests.empty())
+                    timeout /= m_worker_requests.size();
+            }
+            const uint64_t num_slots = num_inferences * std::max(m_device_info.device_batch_size, 1u);
+            return decltype(ov::auto_batch_statistics)::value_type{
+                {"TIMEOUT", timeout},
+                {"INFERENCES", num_inferences},
+                {"REQUESTS", num_requests},
+                {"BATCH_FILL", num_slots ? num_requests * 100 / num_slots : 0}};
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
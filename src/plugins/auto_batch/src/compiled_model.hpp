@@ -5,7 +5,11 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -23,6 +27,8 @@ public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
+        // smaller batched requests (by the batch size) to execute the requests collected by the time-out
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_partial_batch;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
@@ -31,6 +37,21 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        bool _is_idle = false;  // waits for the first request to collect, guarded by the _mutex
+
+        // statistics of the requests arrival and of the batched execution to adapt the timeout to the latency budget
+        void register_arrival(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+        void register_execution(int num_requests);
+        void register_batch_execution_time(std::chrono::steady_clock::duration time);
+        std::uint32_t adapt_timeout(std::uint32_t latency_budget);
+        std::mutex _statistics_mutex;
+        std::chrono::steady_clock::time_point _last_arrival;
+        double _inter_arrival_ms = 0;    // moving average
+        double _batch_execution_ms = 0;  // moving average
+        std::chrono::steady_clock::time_point _batch_execution_start;
+        std::atomic<std::uint32_t> _timeout = {0};  // in ms
+        std::atomic_uint64_t _num_inferences = {0};
+        std::atomic_uint64_t _num_requests = {0};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +62,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::function<ov::SoPtr<ov::ICompiledModel>(int)>& compile_model_with_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,17 +90,31 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // starts compiling the smaller batches in the background on the first call and creates the worker's requests
+    // for them once compiled, returns false if there are no smaller batches (yet) to execute the collected requests
+    bool PreparePartialBatchRequests(WorkerInferRequest& worker_request) const;
+    void WaitPartialBatchCompilation() const;
+    static void ExecutePartialBatch(WorkerInferRequest& worker_request, int num_tasks);
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_latency_budget = {0};  // in ms, the fixed m_time_out is used when 0
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    // the smaller batches (halving the full one) are compiled lazily, as most of the workloads never time out,
+    // and in the background, so the worker executes the timed-out requests in the batch1 mode meanwhile
+    std::function<ov::SoPtr<ov::ICompiledModel>(int)> m_compile_model_with_partial_batch;
+    mutable std::once_flag m_partial_batch_compilation_started;
+    mutable std::future<void> m_partial_batch_compilation;
+    mutable std::atomic_bool m_partial_batch_compiled = {false};
+    // written by the background compilation only before m_partial_batch_compiled is set
+    mutable std::map<int, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_partial_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
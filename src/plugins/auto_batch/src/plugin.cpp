@@ -22,6 +22,7 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_latency_budget.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -118,6 +119,7 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_budget(0));
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -268,28 +270,42 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    // the smaller batches are compiled lazily, after this call, so the model is cloned and the core is not owned
+    auto compile_model_with_batch = [weak_core = std::weak_ptr<ov::ICore>(core),
+                                     model = model->clone(),
+                                     context,
+                                     device_name,
+                                     device_config_no_auto_batch,
+                                     batched_inputs](int batch_size) -> ov::SoPtr<ov::ICompiledModel> {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        auto batch_core = weak_core.lock();
+        OPENVINO_ASSERT(batch_core, "Core is missing!");
+        return context ? batch_core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : batch_core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_model_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
+    // the smaller batches to execute the requests collected by the moment of the time-out, compiled on the first one
+    std::function<ov::SoPtr<ov::ICompiledModel>(int)> compile_model_with_partial_batch;
+    if (compiled_model_with_batch)
+        compile_model_with_partial_batch = compile_model_with_batch;
 
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
@@ -311,7 +327,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compile_model_with_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
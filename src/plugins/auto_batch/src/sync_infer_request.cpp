@@ -80,6 +80,10 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t
 }
 
 void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req) {
+    // the tensors are shared with the other request, so nothing is copied
+    m_copied_input_bytes = 0;
+    m_copied_output_bytes = 0;
+    m_copy_time = {};
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto tensor = get_tensor(it);
@@ -104,42 +108,79 @@ void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferR
     }
 }
 
+const ov::SoPtr<ov::IAsyncInferRequest>& SyncInferRequest::get_executing_batched_request() const {
+    if (m_batched_request_status == eExecutionFlavor::PARTIAL_BATCH_EXECUTED)
+        return m_infer_request_partial_batch;
+    return m_batched_request_wrapper->_infer_request_batched;
+}
+
 void SyncInferRequest::copy_inputs_if_needed() {
+    const bool is_partial = m_batched_request_status == eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+    const auto batch_id = is_partial ? m_partial_batch_id : m_batch_id;
+    const auto batch_size = is_partial ? m_partial_batch_size : m_batch_size;
+    const auto start = std::chrono::steady_clock::now();
+    m_copied_input_bytes = 0;
+    m_copied_output_bytes = 0;
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
-        auto dst_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
-        copy_tensor_if_needed(get_tensor(it), dst_tensor, true);
+        auto dst_tensor = get_executing_batched_request()->get_tensor(it);
+        m_copied_input_bytes += copy_tensor_if_needed(get_tensor(it), dst_tensor, true, batch_id, batch_size);
     }
+    m_copy_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
 }
 
-void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
-                                             ov::SoPtr<ov::ITensor>& dst,
-                                             const bool bInput) {
+size_t SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                                               ov::SoPtr<ov::ITensor>& dst,
+                                               const bool bInput,
+                                               size_t batch_id,
+                                               size_t batch_size) {
     auto ptrDst = static_cast<char*>(dst->data());
     auto ptrSrc = static_cast<char*>(src->data());
     ptrdiff_t szDst = dst->get_byte_size();
     ptrdiff_t szSrc = src->get_byte_size();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szDst / batch_size : 0;
         if ((ptrDst + offset) == ptrSrc)
-            return;
-        else
-            memcpy(ptrDst + offset, ptrSrc, szSrc);
+            return 0;
+        memcpy(ptrDst + offset, ptrSrc, szSrc);
+        return szSrc;
     } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szSrc / batch_size : 0;
         if ((ptrSrc + offset) == ptrDst)
-            return;
-        else
-            memcpy(ptrDst, ptrSrc + offset, szDst);
+            return 0;
+        memcpy(ptrDst, ptrSrc + offset, szDst);
+        return szDst;
     }
 }
 
 void SyncInferRequest::copy_outputs_if_needed() {
+    const bool is_partial = m_batched_request_status == eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+    const auto batch_id = is_partial ? m_partial_batch_id : m_batch_id;
+    const auto batch_size = is_partial ? m_partial_batch_size : m_batch_size;
+    const auto start = std::chrono::steady_clock::now();
     for (const auto& it : get_outputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = get_tensor(it);
-        copy_tensor_if_needed(m_batched_request_wrapper->_infer_request_batched->get_tensor(it), dst_tensor, false);
+        auto src_tensor = get_executing_batched_request()->get_tensor(it);
+        m_copied_output_bytes += copy_tensor_if_needed(src_tensor, dst_tensor, false, batch_id, batch_size);
     }
+    m_copy_time += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+bool SyncInferRequest::has_copies() const {
+    return m_copied_input_bytes + m_copied_output_bytes != 0;
+}
+
+ov::ProfilingInfo SyncInferRequest::get_copy_profiling_info() const {
+    ov::ProfilingInfo info;
+    info.status = has_copies() ? ov::ProfilingInfo::Status::EXECUTED : ov::ProfilingInfo::Status::NOT_RUN;
+    info.real_time = m_copy_time;
+    info.cpu_time = m_copy_time;
+    info.node_name = "AutoBatchCopy";
+    info.node_type = "Copy";
+    info.exec_type = "input_bytes_" + std::to_string(m_copied_input_bytes) + "_output_bytes_" +
+                     std::to_string(m_copied_output_bytes);
+    return info;
 }
 
 void SyncInferRequest::infer() {
@@ -147,16 +188,17 @@ void SyncInferRequest::infer() {
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const {
-    auto states = m_batched_request_wrapper->_infer_request_batched->query_state();
+    const auto& batched_request = get_executing_batched_request();
+    auto states = batched_request->query_state();
     for (auto&& state : states) {
         if (!state._so)
-            state._so = m_batched_request_wrapper->_infer_request_batched._so;
+            state._so = batched_request._so;
     }
     return states;
 }
 
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
-    return m_batched_request_wrapper->_infer_request_batched->get_profiling_info();
+    return get_executing_batched_request()->get_profiling_info();
 }
 }  // namespace autobatch_plugin
 }  // namespace ov
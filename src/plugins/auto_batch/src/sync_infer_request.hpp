@@ -40,19 +40,43 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
+    // the smaller batched request (and the slot in it) that executed the request collected by the time-out
+    ov::SoPtr<ov::IAsyncInferRequest> m_infer_request_partial_batch;
+    size_t m_partial_batch_id = 0;
+    size_t m_partial_batch_size = 0;
+
     size_t get_batch_size() const;
 
+    // whether the last inference copied any inputs/outputs (for the tensors set by the user)
+    bool has_copies() const;
+
+    // the profiling info on the inputs/outputs copied by the last inference
+    ov::ProfilingInfo get_copy_profiling_info() const;
+
 protected:
-    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
+    // returns the number of the copied bytes (zero when the tensor is the view into the batched tensor already)
+    size_t copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                                 ov::SoPtr<ov::ITensor>& dst,
+                                 const bool bInput,
+                                 size_t batch_id,
+                                 size_t batch_size);
+
+    // the batched request executing this one: either the full batched request or the smaller one
+    const ov::SoPtr<ov::IAsyncInferRequest>& get_executing_batched_request() const;
 
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
 
     size_t m_batch_id;
 
+    size_t m_copied_input_bytes = 0;
+    size_t m_copied_output_bytes = 0;
+    std::chrono::microseconds m_copy_time{0};
+
     size_t m_batch_size;
 };
 }  // namespace autobatch_plugin
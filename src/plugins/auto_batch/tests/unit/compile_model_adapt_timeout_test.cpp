@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+
+#include "common_test_utils/subgraph_builders/multi_single_conv.hpp"
+#include "mock_common.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
+#include "sync_infer_request.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using namespace std::chrono_literals;
+
+class AutoBatchAdaptTimeoutTest : public ::testing::Test {
+public:
+    std::shared_ptr<ov::Model> m_model;
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockIPlugin>> m_hardware_plugin;
+
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+
+    std::set<std::size_t> m_batched_inputs;
+    std::set<std::size_t> m_batched_outputs;
+
+    std::shared_ptr<ov::threading::ImmediateExecutor> m_executor;
+
+    static constexpr std::uint32_t m_batch_size = 4;
+
+    void TearDown() override {
+        m_auto_batch_plugin.reset();
+        m_model.reset();
+        m_core.reset();
+        m_i_compile_model_without_batch.reset();
+        m_i_compile_model_with_batch.reset();
+        m_executor.reset();
+    }
+
+    void SetUp() override {
+        m_model = ov::test::utils::make_multi_single_conv({1, 3, 24, 24}, ov::element::f32);
+        for (size_t input_id = 0; input_id < m_model->get_parameters().size(); input_id++) {
+            m_batched_inputs.insert(input_id);
+        }
+        for (size_t output_id = 0; output_id < m_model->get_results().size(); output_id++) {
+            m_batched_outputs.insert(output_id);
+        }
+
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_hardware_plugin = std::shared_ptr<NiceMock<MockIPlugin>>(new NiceMock<MockIPlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+        m_executor = std::make_shared<ov::threading::ImmediateExecutor>();
+
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(m_model, m_hardware_plugin);
+        m_i_compile_model_with_batch = std::make_shared<NiceMock<MockICompiledModel>>(m_model, m_hardware_plugin);
+        ON_CALL(*m_i_compile_model_with_batch, create_infer_request()).WillByDefault([this]() {
+            return std::make_shared<NiceMock<MockIAsyncInferRequest>>(
+                std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_with_batch),
+                m_executor,
+                nullptr);
+        });
+    }
+
+    std::shared_ptr<CompiledModel> create_compiled_model(std::uint32_t latency_budget) {
+        const ov::AnyMap config = {{ov::auto_batch_timeout.name(), "200"},
+                                   {ov::auto_batch_latency_budget.name(), latency_budget}};
+        const ov::SoPtr<ov::ICompiledModel> compile_model_with_batch = {m_i_compile_model_with_batch, {}};
+        const ov::SoPtr<ov::ICompiledModel> compile_model_without_batch = {m_i_compile_model_without_batch, {}};
+        return std::make_shared<CompiledModel>(m_model->clone(),
+                                               m_auto_batch_plugin,
+                                               config,
+                                               DeviceInformation{"CPU", {}, m_batch_size},
+                                               m_batched_inputs,
+                                               m_batched_outputs,
+                                               compile_model_with_batch,
+                                               compile_model_without_batch,
+                                               ov::SoPtr<ov::IRemoteContext>{});
+    }
+
+    // the requests arriving every inter_arrival and the batches executing for batch_execution
+    static void register_statistics(CompiledModel::WorkerInferRequest& worker,
+                                    std::chrono::milliseconds inter_arrival,
+                                    std::chrono::milliseconds batch_execution) {
+        const auto start = worker._last_arrival == std::chrono::steady_clock::time_point{}
+                               ? std::chrono::steady_clock::time_point{} + 1s
+                               : worker._last_arrival;
+        for (int arrival = 0; arrival < 64; arrival++) {
+            worker.register_arrival(start + (arrival + 1) * inter_arrival);
+            if (arrival % m_batch_size == 0)
+                worker.register_batch_execution_time(batch_execution);
+        }
+    }
+};
+
+TEST_F(AutoBatchAdaptTimeoutTest, WaitOnlyIfMoreRequestsFitTheBudget) {
+    CompiledModel::WorkerInferRequest worker;
+    // no statistics yet, the whole budget is left to collect the batch
+    EXPECT_EQ(worker.adapt_timeout(50), 50u);
+
+    register_statistics(worker, 10ms, 20ms);
+    // the next requests arrive within the 30 ms left after the execution
+    EXPECT_EQ(worker.adapt_timeout(50), 30u);
+    // the next request arrives after the 5 ms left, so the collected requests are executed at once
+    EXPECT_EQ(worker.adapt_timeout(25), 1u);
+    // the execution alone exceeds the budget
+    EXPECT_EQ(worker.adapt_timeout(15), 1u);
+
+    // the faster arrivals make the waiting worth it again
+    register_statistics(worker, 2ms, 20ms);
+    EXPECT_EQ(worker.adapt_timeout(25), 5u);
+}
+
+TEST_F(AutoBatchAdaptTimeoutTest, IdleWorkerWaitsWithoutTimeout) {
+    auto compiled_model = create_compiled_model(1);
+    auto request = std::dynamic_pointer_cast<SyncInferRequest>(compiled_model->create_sync_infer_request());
+    ASSERT_NE(request, nullptr);
+    const auto worker = request->m_batched_request_wrapper;
+    register_statistics(*worker, 10ms, 20ms);
+
+    // no request is queued, so the worker does not wake up by the 1 ms timeout to adapt it
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(worker->_timeout, 0u);
+    // the idle worker is woken up on the destruction
+    request.reset();
+    compiled_model.reset();
+}
+
+TEST_F(AutoBatchAdaptTimeoutTest, BatchFill) {
+    auto compiled_model = create_compiled_model(50);
+    auto get_statistics = [&compiled_model]() {
+        return compiled_model->get_property(ov::auto_batch_statistics.name())
+            .as<decltype(ov::auto_batch_statistics)::value_type>();
+    };
+    EXPECT_EQ(get_statistics().at("BATCH_FILL"), 0u);
+
+    auto request = std::dynamic_pointer_cast<SyncInferRequest>(compiled_model->create_sync_infer_request());
+    ASSERT_NE(request, nullptr);
+    const auto worker = request->m_batched_request_wrapper;
+    // the full batch and the batch of 2 requests collected by the timeout
+    worker->register_execution(m_batch_size);
+    worker->register_execution(2);
+    auto statistics = get_statistics();
+    EXPECT_EQ(statistics.at("INFERENCES"), 2u);
+    EXPECT_EQ(statistics.at("REQUESTS"), 6u);
+    EXPECT_EQ(statistics.at("BATCH_FILL"), 75u);
+
+    worker->register_execution(m_batch_size);
+    worker->register_execution(m_batch_size);
+    EXPECT_EQ(get_statistics().at("BATCH_FILL"), 87u);
+}
@@ -0,0 +1,243 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "async_infer_request.hpp"
+#include "common_test_utils/subgraph_builders/multi_single_conv.hpp"
+#include "mock_common.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using PartialBatchTestParams = std::tuple<int,                // number of the requests collected by the time-out
+                                          std::vector<int>>;  // expected batch sizes of the executions
+
+class PartialBatchCompiledModel : public CompiledModel {
+public:
+    using CompiledModel::CompiledModel;
+    using CompiledModel::ExecutePartialBatch;
+    using CompiledModel::PreparePartialBatchRequests;
+    using CompiledModel::WaitPartialBatchCompilation;
+
+    // the smaller batches are compiled in the background on the first time-out
+    bool PreparePartialBatchRequestsCompiled(WorkerInferRequest& worker_request) const {
+        PreparePartialBatchRequests(worker_request);
+        WaitPartialBatchCompilation();
+        return PreparePartialBatchRequests(worker_request);
+    }
+};
+
+class AutoBatchPartialBatchTest : public ::testing::TestWithParam<PartialBatchTestParams> {
+public:
+    std::shared_ptr<ov::Model> m_model;
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockIPlugin>> m_hardware_plugin;
+
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+
+    ov::AnyMap m_config;
+    DeviceInformation m_device_info;
+    std::set<std::size_t> m_batched_inputs;
+    std::set<std::size_t> m_batched_outputs;
+
+    std::shared_ptr<ov::threading::ImmediateExecutor> m_executor;
+    std::shared_ptr<NiceMock<MockIAsyncInferRequest>> m_async_infer_request_with_batch;
+    std::shared_ptr<NiceMock<MockIAsyncInferRequest>> m_async_infer_request_without_batch;
+
+    // the compiled models with the smaller batches and the batch sizes of the executed requests
+    std::vector<int> m_compiled_batch_sizes;
+    std::vector<std::shared_ptr<NiceMock<MockICompiledModel>>> m_i_compile_models_with_partial_batch;
+    std::vector<int> m_executed_batch_sizes;
+
+    static constexpr int m_batch_size = 8;
+
+    static std::string getTestCaseName(const testing::TestParamInfo<PartialBatchTestParams>& obj) {
+        return "collected_" + std::to_string(std::get<0>(obj.param)) + "_of_" + std::to_string(m_batch_size);
+    }
+
+    void TearDown() override {
+        m_auto_batch_plugin.reset();
+        m_model.reset();
+        m_core.reset();
+        m_i_compile_model_without_batch.reset();
+        m_i_compile_model_with_batch.reset();
+        m_i_compile_models_with_partial_batch.clear();
+        m_async_infer_request_with_batch.reset();
+        m_async_infer_request_without_batch.reset();
+        m_executor.reset();
+    }
+
+    void SetUp() override {
+        m_model = ov::test::utils::make_multi_single_conv({1, 3, 24, 24}, ov::element::f32);
+        for (size_t input_id = 0; input_id < m_model->get_parameters().size(); input_id++) {
+            m_batched_inputs.insert(input_id);
+        }
+        for (size_t output_id = 0; output_id < m_model->get_results().size(); output_id++) {
+            m_batched_outputs.insert(output_id);
+        }
+
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_hardware_plugin = std::shared_ptr<NiceMock<MockIPlugin>>(new NiceMock<MockIPlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+
+        m_config = {{ov::auto_batch_timeout.name(), "200"}};
+        m_device_info = {"CPU", {}, m_batch_size};
+        m_executor = std::make_shared<ov::threading::ImmediateExecutor>();
+
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(m_model, m_hardware_plugin);
+        m_async_infer_request_without_batch = std::make_shared<NiceMock<MockIAsyncInferRequest>>(
+            std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_without_batch),
+            m_executor,
+            nullptr);
+
+        m_i_compile_model_with_batch =
+            std::make_shared<NiceMock<MockICompiledModel>>(reshape(m_batch_size), m_hardware_plugin);
+        m_async_infer_request_with_batch = std::make_shared<NiceMock<MockIAsyncInferRequest>>(
+            std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_with_batch),
+            m_executor,
+            nullptr);
+    }
+
+    std::shared_ptr<ov::Model> reshape(int batch_size) const {
+        auto reshaped = m_model->clone();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        const auto inputs = reshaped->inputs();
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            input_shape[0] = batch_size;
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+        reshaped->reshape(partial_shapes);
+        return reshaped;
+    }
+
+    // the mocked compilation of the smaller batches, the ones below min_batch_size fail to compile
+    std::shared_ptr<PartialBatchCompiledModel> create_compiled_model(bool with_partial_batch, int min_batch_size = 2) {
+        std::function<ov::SoPtr<ov::ICompiledModel>(int)> compile_model_with_partial_batch;
+        if (with_partial_batch) {
+            compile_model_with_partial_batch = [this, min_batch_size](int batch_size) -> ov::SoPtr<ov::ICompiledModel> {
+                m_compiled_batch_sizes.push_back(batch_size);
+                if (batch_size < min_batch_size)
+                    OPENVINO_THROW("Cannot compile the batch ", batch_size);
+                auto compiled_model =
+                    std::make_shared<NiceMock<MockICompiledModel>>(reshape(batch_size), m_hardware_plugin);
+                std::weak_ptr<NiceMock<MockICompiledModel>> weak_model = compiled_model;
+                ON_CALL(*compiled_model, create_infer_request()).WillByDefault([this, weak_model, batch_size]() {
+                    auto sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(weak_model.lock());
+                    ON_CALL(*sync_request, infer()).WillByDefault([this, batch_size]() {
+                        m_executed_batch_sizes.push_back(batch_size);
+                    });
+                    return std::make_shared<NiceMock<MockIAsyncInferRequest>>(sync_request, m_executor, nullptr);
+                });
+                m_i_compile_models_with_partial_batch.push_back(compiled_model);
+                return {compiled_model, {}};
+            };
+        }
+        const ov::SoPtr<ov::ICompiledModel> compile_model_with_batch = {m_i_compile_model_with_batch, {}};
+        const ov::SoPtr<ov::ICompiledModel> compile_model_without_batch = {m_i_compile_model_without_batch, {}};
+        return std::make_shared<PartialBatchCompiledModel>(m_model->clone(),
+                                                           m_auto_batch_plugin,
+                                                           m_config,
+                                                           m_device_info,
+                                                           m_batched_inputs,
+                                                           m_batched_outputs,
+                                                           compile_model_with_batch,
+                                                           compile_model_without_batch,
+                                                           ov::SoPtr<ov::IRemoteContext>{},
+                                                           compile_model_with_partial_batch);
+    }
+
+    std::shared_ptr<CompiledModel::WorkerInferRequest> create_worker() const {
+        auto worker = std::make_shared<CompiledModel::WorkerInferRequest>();
+        worker->_infer_request_batched = {m_async_infer_request_with_batch, {}};
+        worker->_batch_size = m_batch_size;
+        worker->_completion_tasks.resize(m_batch_size);
+        return worker;
+    }
+};
+
+TEST_P(AutoBatchPartialBatchTest, CompileSmallerBatchesOnFirstTimeout) {
+    auto compiled_model = create_compiled_model(true);
+    auto worker = create_worker();
+    // nothing is compiled until the time-out
+    EXPECT_TRUE(m_compiled_batch_sizes.empty());
+    // the first time-out starts the compilation in the background, and the worker executes the requests in the
+    // batch1 mode till the compilation completes
+    compiled_model->PreparePartialBatchRequests(*worker);
+    compiled_model->WaitPartialBatchCompilation();
+    EXPECT_EQ(m_compiled_batch_sizes, (std::vector<int>{4, 2}));
+    ASSERT_TRUE(compiled_model->PreparePartialBatchRequests(*worker));
+    EXPECT_EQ(worker->_infer_requests_partial_batch.size(), 2u);
+
+    // the other workers reuse the compiled models
+    auto other_worker = create_worker();
+    ASSERT_TRUE(compiled_model->PreparePartialBatchRequests(*other_worker));
+    ASSERT_TRUE(compiled_model->PreparePartialBatchRequests(*worker));
+    EXPECT_EQ(m_compiled_batch_sizes, (std::vector<int>{4, 2}));
+    EXPECT_EQ(other_worker->_infer_requests_partial_batch.size(), 2u);
+}
+
+TEST_P(AutoBatchPartialBatchTest, ExecuteCollectedRequestsInSmallerBatches) {
+    const auto& [num_collected, expected_batches] = GetParam();
+    auto compiled_model = create_compiled_model(true);
+    auto worker = create_worker();
+    ASSERT_TRUE(compiled_model->PreparePartialBatchRequestsCompiled(*worker));
+
+    std::vector<std::shared_ptr<AsyncInferRequest>> requests;
+    int completed = 0;
+    for (int batch_id = 0; batch_id < num_collected; batch_id++) {
+        auto sync_request = std::make_shared<SyncInferRequest>(compiled_model,
+                                                               worker,
+                                                               batch_id,
+                                                               m_batch_size,
+                                                               m_batched_inputs,
+                                                               m_batched_outputs);
+        requests.push_back(
+            std::make_shared<AsyncInferRequest>(sync_request, m_async_infer_request_without_batch, nullptr));
+        worker->_tasks.push({requests.back().get(), [&completed]() {
+                                 completed++;
+                             }});
+    }
+
+    PartialBatchCompiledModel::ExecutePartialBatch(*worker, num_collected);
+    EXPECT_EQ(completed, num_collected);
+    EXPECT_EQ(worker->_tasks.size(), 0u);
+    EXPECT_EQ(m_executed_batch_sizes, expected_batches);
+
+    // the requests fill the slots of the executing batches one by one
+    size_t execution = 0;
+    size_t slot = 0;
+    for (const auto& request : requests) {
+        const auto& sync_request = request->m_sync_request;
+        ASSERT_LT(execution, expected_batches.size());
+        EXPECT_EQ(sync_request->m_batched_request_status, SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED);
+        EXPECT_EQ(sync_request->m_partial_batch_size, static_cast<size_t>(expected_batches[execution]));
+        EXPECT_EQ(sync_request->m_partial_batch_id, slot);
+        EXPECT_FALSE(sync_request->m_exception_ptr);
+        if (++slot == static_cast<size_t>(expected_batches[execution])) {
+            execution++;
+            slot = 0;
+        }
+    }
+}
+
+TEST_P(AutoBatchPartialBatchTest, NoSmallerBatchesWithoutCompilation) {
+    auto worker = create_worker();
+    EXPECT_FALSE(create_compiled_model(false)->PreparePartialBatchRequests(*worker));
+    // the failed compilation of a smaller batch stops the halving
+    EXPECT_TRUE(create_compiled_model(true, 4)->PreparePartialBatchRequestsCompiled(*worker));
+    EXPECT_EQ(m_compiled_batch_sizes, (std::vector<int>{4, 2}));
+    EXPECT_EQ(worker->_infer_requests_partial_batch.size(), 1u);
+    EXPECT_EQ(worker->_infer_requests_partial_batch.begin()->first, 4);
+}
+
+// 7 of 8: the batch of 4 and the padded batch of 4 for the remaining 3, 3 of 8: the padded batch of 4
+const std::vector<PartialBatchTestParams> partial_batch_params{{7, {4, 4}}, {3, {4}}, {2, {2}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
+                         AutoBatchPartialBatchTest,
+                         ::testing::ValuesIn(partial_batch_params),
+                         AutoBatchPartialBatchTest::getTestCaseName);
@@ -8,6 +8,7 @@
 #include "mock_common.hpp"
 #include "openvino/core/dimension.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 #include "transformations/utils/utils.hpp"
 #include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
@@ -203,6 +204,35 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_outputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyUserTensorOnlyTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  m_batch_size - 1,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    // the tensors of the request are the views into the batched tensors
+    req->copy_inputs_if_needed();
+    req->copy_outputs_if_needed();
+    EXPECT_FALSE(req->has_copies());
+    EXPECT_EQ(req->get_copy_profiling_info().exec_type, "input_bytes_0_output_bytes_0");
+
+    const auto& input = req->get_inputs()[0];
+    const auto view = req->get_tensor(input);
+    const ov::SoPtr<ov::ITensor> user_tensor = ov::make_tensor(view->get_element_type(), view->get_shape());
+    req->set_tensor(input, user_tensor);
+    req->copy_inputs_if_needed();
+    EXPECT_TRUE(req->has_copies());
+    EXPECT_EQ(req->get_copy_profiling_info().exec_type,
+              "input_bytes_" + std::to_string(user_tensor->get_byte_size()) + "_output_bytes_0");
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
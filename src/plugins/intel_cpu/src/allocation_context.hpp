@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,8 @@ struct AllocationContext {
     std::vector<std::shared_ptr<Edge>> edges;
     GlobalExecutionIndex execIndex;
     std::vector<size_t> syncPoints;
+    // nodes executed concurrently with the neighbours, their memory must stay alive for the whole execution index range
+    std::unordered_set<std::shared_ptr<Node>> concurrentNodes;
 };
 
 }  // namespace ov::intel_cpu
@@ -4,20 +4,84 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "lru_cache.h"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Defines whether the values of type T (or the type pointed by a shared_ptr value) may be stored in a runtime
+ * cache shared by several streams. The type is considered thread safe if it declares
+ * static constexpr bool threadSafeCacheValue = true, which means that the object is not modified after the
+ * construction and all its methods may be called concurrently.
+ */
+template <typename T, typename = void>
+struct IsThreadSafeCacheValue : std::false_type {};
+
+template <typename T>
+struct IsThreadSafeCacheValue<T, std::enable_if_t<T::threadSafeCacheValue>> : std::true_type {};
+
+template <typename T>
+struct IsThreadSafeCacheValue<std::shared_ptr<T>> : IsThreadSafeCacheValue<T> {};
+
+template <typename T, typename = void>
+struct HasCacheCost : std::false_type {};
+
+template <typename T>
+struct HasCacheCost<T, std::void_t<decltype(std::declval<const T&>().cacheCost())>> : std::true_type {};
+
+/**
+ * @brief Estimates the memory footprint in bytes of a value stored in the runtime cache. A value type (or the type
+ * pointed by a shared_ptr value) may define size_t cacheCost() const method to report the memory it holds, e.g. the
+ * generated code or the memory of the primitive and its scratchpad. Otherwise the size of the object is used.
+ */
+template <typename T>
+size_t estimateCacheCost(const T& value) {
+    if constexpr (HasCacheCost<T>::value) {
+        return value.cacheCost();
+    } else {
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+size_t estimateCacheCost(const std::shared_ptr<T>& value) {
+    return value ? estimateCacheCost(*value) : 0;
+}
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual Statistics getStatistics() const = 0;
+    [[nodiscard]] virtual size_t size() const = 0;
+    [[nodiscard]] virtual size_t getBytes() const = 0;
+    /**
+     * @return the clock tick of the last use of the least recently used record, the maximum value if there are none
+     */
+    [[nodiscard]] virtual uint64_t getOldestUse() const = 0;
+    /**
+     * @brief Evicts the least recently used record
+     * @return the cost of the evicted record in bytes
+     */
+    virtual size_t evictOldest() = 0;
 };
 
 /**
@@ -25,8 +89,9 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType, size_t cost), ValueType
+ * get(const KeyType&), evict(size_t), getOldestUse(), size(), getBytes() and getEvictions() interface and must have
+ * constructor of type ImplType(size_t, std::shared_ptr<CacheClock>).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -36,7 +101,8 @@ class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    explicit CacheEntry(size_t capacity, std::shared_ptr<CacheClock> clock = nullptr)
+        : _impl(capacity, std::move(clock)) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the
@@ -50,6 +116,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            count(_misses);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -57,15 +124,63 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            count(_misses);
             retVal = builder(key);
             if (retVal != retEmpty) {
-                _impl.put(key, retVal);
+                _impl.put(key, retVal, estimateCacheCost(retVal));
             }
+        } else {
+            count(_hits);
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] Statistics getStatistics() const override {
+        Statistics stats;
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = _misses.load(std::memory_order_relaxed);
+        stats.evictions = _impl.getEvictions();
+        stats.entries = _impl.size();
+        stats.bytes = _impl.getBytes();
+        return stats;
+    }
+
+    [[nodiscard]] size_t size() const override {
+        return _impl.size();
+    }
+
+    [[nodiscard]] size_t getBytes() const override {
+        return _impl.getBytes();
+    }
+
+    [[nodiscard]] uint64_t getOldestUse() const override {
+        return _impl.getOldestUse();
+    }
+
+    size_t evictOldest() override {
+        if constexpr (std::is_same_v<ImplType, LruCache<KeyType, ValType>>) {
+            const size_t bytes = _impl.getBytes();
+            _impl.evict(1);
+            return bytes - _impl.getBytes();
+        } else {
+            return _impl.evictOldest();
+        }
+    }
+
     ImplType _impl;
+
+private:
+    // the unsynchronized storage has the only writer, so the atomic read-modify-write is avoided
+    static void count(std::atomic_size_t& counter) {
+        if constexpr (std::is_same_v<ImplType, LruCache<KeyType, ValType>>) {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 }  // namespace ov::intel_cpu
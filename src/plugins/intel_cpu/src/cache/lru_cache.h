@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <list>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 
@@ -15,38 +19,66 @@
  * comparison operator.
  * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
  *
- * @attention This cache implementation IS NOT THREAD SAFE!
+ * @attention This cache implementation IS NOT THREAD SAFE! Only size(), getBytes() and getEvictions() may be called
+ * concurrently with the modifications, e.g. to collect the statistics.
  */
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Logical clock shared by several caches. Each record remembers the tick of its last use, so the least recently
+ * used record may be found among all the caches using the same clock, e.g. to evict it when their total cost exceeds
+ * a byte budget.
+ */
+class CacheClock {
+public:
+    uint64_t tick() {
+        return _ticks.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+private:
+    std::atomic<uint64_t> _ticks{0};
+};
+
 template <typename Key, typename Value>
 class LruCache {
 public:
     using value_type = std::pair<Key, Value>;
 
-    explicit LruCache(size_t capacity) : _capacity(capacity) {}
+    /**
+     * @param capacity is the maximum number of records
+     * @param clock orders the uses of the records of several caches, no ordering is tracked if it is not provided
+     */
+    explicit LruCache(size_t capacity, std::shared_ptr<CacheClock> clock = nullptr)
+        : _capacity(capacity),
+          _clock(std::move(clock)) {}
 
     /**
      * @brief Puts the value associated with the key into the cache.
      * @param key
      * @param value
+     * @param cost is the estimated memory footprint of the value in bytes
      */
 
-    void put(const Key& key, const Value& val) {
+    void put(const Key& key, const Value& val, size_t cost = 0) {
         if (0 == _capacity) {
             return;
         }
         auto mapItr = _cacheMapper.find(key);
         if (mapItr != _cacheMapper.end()) {
             touch(mapItr->second);
-            mapItr->second->second = val;
+            setBytes(getBytes() - mapItr->second->cost + cost);
+            mapItr->second->value = val;
+            mapItr->second->cost = cost;
         } else {
             if (_cacheMapper.size() == _capacity) {
                 evict(1);
             }
-            auto itr = _lruList.insert(_lruList.begin(), {key, val});
+            auto itr = _lruList.insert(_lruList.begin(), {key, val, cost, now()});
             _cacheMapper.insert({key, itr});
+            // the only writer, so no atomic read-modify-write is needed
+            _size.store(_cacheMapper.size(), std::memory_order_relaxed);
+            setBytes(getBytes() + cost);
         }
     }
 
@@ -63,7 +95,7 @@ public:
         }
 
         touch(itr->second);
-        return _lruList.front().second;
+        return _lruList.front().value;
     }
 
     /**
@@ -72,10 +104,24 @@ public:
      */
 
     void evict(size_t n) {
-        for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
-            _cacheMapper.erase(_lruList.back().first);
+        size_t evicted = 0;
+        size_t bytes = getBytes();
+        for (; evicted < n && !_lruList.empty(); ++evicted) {
+            bytes -= _lruList.back().cost;
+            _cacheMapper.erase(_lruList.back().key);
             _lruList.pop_back();
         }
+        _size.store(_cacheMapper.size(), std::memory_order_relaxed);
+        setBytes(bytes);
+        _evictions.store(_evictions.load(std::memory_order_relaxed) + evicted, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the clock tick of the last use of the least recently used record
+     * @return the tick or the maximum value if the cache is empty
+     */
+    [[nodiscard]] uint64_t getOldestUse() const {
+        return _lruList.empty() ? std::numeric_limits<uint64_t>::max() : _lruList.back().lastUse;
     }
 
     /**
@@ -86,6 +132,30 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the number of records currently stored in the cache
+     * @return the number of records
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        return _size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the estimated memory footprint of the records currently stored in the cache
+     * @return the sum of the costs of the records in bytes
+     */
+    [[nodiscard]] size_t getBytes() const noexcept {
+        return _bytes.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache since its creation
+     * @return the number of evicted records
+     */
+    [[nodiscard]] size_t getEvictions() const noexcept {
+        return _evictions.load(std::memory_order_relaxed);
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -93,16 +163,36 @@ private:
         }
     };
 
-    using lru_list_type = std::list<value_type>;
+    struct Record {
+        Key key;
+        Value value;
+        size_t cost;
+        uint64_t lastUse;
+    };
+
+    using lru_list_type = std::list<Record>;
     using cache_map_value_type = typename lru_list_type::iterator;
 
     void touch(typename lru_list_type::iterator itr) {
         _lruList.splice(_lruList.begin(), _lruList, itr);
+        itr->lastUse = now();
+    }
+
+    uint64_t now() {
+        return _clock ? _clock->tick() : 0;
+    }
+
+    void setBytes(size_t bytes) {
+        _bytes.store(bytes, std::memory_order_relaxed);
     }
 
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    std::shared_ptr<CacheClock> _clock;
+    std::atomic_size_t _size{0};
+    std::atomic_size_t _bytes{0};
+    std::atomic_size_t _evictions{0};
 };
 
 }  // namespace ov::intel_cpu
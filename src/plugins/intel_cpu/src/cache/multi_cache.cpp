@@ -5,9 +5,91 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <typeinfo>
+
+#ifndef _WIN32
+#    include <cxxabi.h>
+#endif
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics result;
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    for (const auto& item : _storage) {
+        const auto stats = item.second->getStatistics();
+        result.hits += stats.hits;
+        result.misses += stats.misses;
+        result.evictions += stats.evictions;
+        result.entries += stats.entries;
+        result.bytes += stats.bytes;
+    }
+    return result;
+}
+
+size_t MultiCache::getBytes() const {
+    size_t result = 0;
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    for (const auto& item : _storage) {
+        result += item.second->getBytes();
+    }
+    return result;
+}
+
+void MultiCache::applyByteBudget() {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    while (true) {
+        size_t bytes = 0;
+        size_t records = 0;
+        CacheEntryBase* oldest = nullptr;
+        uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+        for (const auto& item : _storage) {
+            bytes += item.second->getBytes();
+            records += item.second->size();
+            const auto use = item.second->getOldestUse();
+            if (use < oldestUse) {
+                oldestUse = use;
+                oldest = item.second.get();
+            }
+        }
+        // the record just added is the most recently used one, it is kept even if it alone exceeds the budget
+        if (bytes <= _byteBudget || records <= 1 || !oldest) {
+            return;
+        }
+        oldest->evictOldest();
+    }
+}
+
+std::map<std::string, MultiCache::Statistics> MultiCache::getStatisticsPerType() const {
+    std::map<std::string, Statistics> result;
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    for (const auto& item : _storage) {
+        result[_typeNames.at(item.first)] = item.second->getStatistics();
+    }
+    return result;
+}
+
+std::string MultiCache::getTypeName(const std::type_info& info) {
+    std::string name = info.name();
+#ifndef _WIN32
+    int status = 0;
+    std::unique_ptr<char, void (*)(void*)> demangled_name(abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status),
+                                                          std::free);
+    if (status == 0 && demangled_name) {
+        name = demangled_name.get();
+    }
+#endif
+    return name;
+}
+
 }  // namespace ov::intel_cpu
@@ -6,33 +6,77 @@
 
 #include <atomic>
 #include <cstddef>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "openvino/core/except.hpp"
+#include "sharded_lru_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention By default this implementation IS NOT THREAD SAFE! A thread safe instance, which stores the records in
+ * sharded LRU caches and guards the entries map by a read-mostly lock, may be shared between several streams. The
+ * streams keep their own unsynchronized instances and delegate to the shared one only the value types marked as thread
+ * safe (see IsThreadSafeCacheValue).
+ * The estimated memory footprint of the records (see estimateCacheCost) may be bounded by a byte budget. The records
+ * of all the entries are ordered by their last use, so the least recently used ones are evicted first whatever their
+ * type is.
  */
 
 class MultiCache {
 public:
+    using Statistics = CacheEntryBase::Statistics;
     template <typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
-    using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
-    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    using SyncEntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
+    using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
 
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param threadSafe defines whether the instance may be used from several threads concurrently
+     * @param byteBudget is the limit of the estimated memory footprint of all the records, zero means no limit
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false, size_t byteBudget = 0)
+        : _capacity(capacity),
+          _threadSafe(threadSafe),
+          _byteBudget(byteBudget),
+          _clock(byteBudget ? std::make_shared<CacheClock>() : nullptr) {}
+
+    /**
+     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param sharedCache is the thread safe cache used for the thread safe value types
+     * @param byteBudget is the limit of the estimated memory footprint of the records not delegated to the shared cache
+     */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> sharedCache, size_t byteBudget = 0)
+        : _capacity(capacity),
+          _byteBudget(byteBudget),
+          _clock(byteBudget ? std::make_shared<CacheClock>() : nullptr),
+          _sharedCache(std::move(sharedCache)) {
+        OPENVINO_ASSERT(!_sharedCache || _sharedCache->_threadSafe, "The shared runtime cache must be thread safe");
+    }
+
+    MultiCache(const MultiCache& other)
+        : _capacity(other._capacity),
+          _threadSafe(other._threadSafe),
+          _byteBudget(other._byteBudget),
+          _clock(other._clock),
+          _sharedCache(other._sharedCache) {
+        std::shared_lock<std::shared_mutex> lock(other._mutex);
+        _storage = other._storage;
+        _typeNames = other._typeNames;
+    }
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,19 +91,71 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        if constexpr (IsThreadSafeCacheValue<ValueType>::value) {
+            if (_sharedCache) {
+                return _sharedCache->getOrCreate(key, std::move(builder));
+            }
+        }
+        using SyncEntry = SyncEntryTypeT<KeyType, ValueType>;
+        using Entry = EntryTypeT<KeyType, ValueType>;
+        typename Entry::ResultType result;
+        if (_threadSafe) {
+            result = getEntry<KeyType, ValueType, SyncEntry>()->getOrCreate(key, std::move(builder));
+        } else {
+            result = getEntry<KeyType, ValueType, Entry>()->getOrCreate(key, std::move(builder));
+        }
+        if (_byteBudget && result.second == CacheEntryBase::LookUpStatus::Miss) {
+            applyByteBudget();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Collects the lookup statistics accumulated by all the entries of the cache
+     * @return sum of hits, misses, evictions and stored records over all the key/value pair types
+     * @note the statistics of the shared cache are not included
+     */
+    [[nodiscard]] Statistics getStatistics() const;
+
+    /**
+     * @brief Returns the estimated memory footprint of the records stored in the cache
+     * @return the sum of the costs of the records of all the entries in bytes
+     * @note the records of the shared cache are not included
+     */
+    [[nodiscard]] size_t getBytes() const;
+
+    /**
+     * @brief Collects the lookup statistics of each entry of the cache
+     * @return map of the statistics, where the key is the "<key type> -> <value type>" name of the entry
+     */
+    [[nodiscard]] std::map<std::string, Statistics> getStatisticsPerType() const;
+
+    [[nodiscard]] const std::shared_ptr<MultiCache>& getSharedCache() const {
+        return _sharedCache;
     }
 
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename KeyType, typename ValueType, typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
+
+    static std::string getTypeName(const std::type_info& info);
+
+    // evicts the least recently used records of all the entries while their footprint exceeds the byte budget
+    void applyByteBudget();
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe = false;
+    size_t _byteBudget = 0;
+    std::shared_ptr<CacheClock> _clock;
+    std::shared_ptr<MultiCache> _sharedCache;
+    // the lookups of an instance that is not thread safe are not locked, since the only writer is the owner thread,
+    // the insertions are locked anyway so the statistics may be collected from another thread
+    mutable std::shared_mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    std::unordered_map<size_t, std::string> _typeNames;
 };
 
 template <typename T>
@@ -68,13 +164,27 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename KeyType, typename ValueType, typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    if (_threadSafe) {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    } else {
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _clock)});
+        // several entries may share a key type, so the value type is a part of the name
+        _typeNames.insert({id, getTypeName(typeid(KeyType)) + " -> " + getTypeName(typeid(ValueType))});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
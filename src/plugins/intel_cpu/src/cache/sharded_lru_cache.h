@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy. The key space is split into a number of shards, each
+ * shard is an independent LruCache protected by its own mutex, so concurrent lookups of different keys rarely contend.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU policy is applied per shard, so the eviction order is only approximately global. Small caches are
+ * kept in a single shard to preserve the exact LRU behavior.
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t maxShards = 16;
+    static constexpr size_t minShardCapacity = 256;
+
+    /**
+     * @param capacity is the maximum number of records
+     * @param clock orders the uses of the records of all the shards, no ordering is tracked if it is not provided
+     */
+    explicit ShardedLruCache(size_t capacity, const std::shared_ptr<CacheClock>& clock = nullptr)
+        : _capacity(capacity) {
+        const size_t numShards = std::clamp<size_t>(capacity / minShardCapacity, 1, maxShards);
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity, clock));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @param cost is the estimated memory footprint of the value in bytes
+     */
+    void put(const Key& key, const Value& val, size_t cost = 0) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val, cost);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts up to n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the clock tick of the last use of the least recently used record among all the shards
+     * @return the tick or the maximum value if the cache is empty
+     */
+    [[nodiscard]] uint64_t getOldestUse() const {
+        uint64_t result = std::numeric_limits<uint64_t>::max();
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result = std::min(result, shard->cache.getOldestUse());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Evicts the least recently used record among all the shards
+     * @return the cost of the evicted record in bytes
+     */
+    size_t evictOldest() {
+        Shard* oldest = nullptr;
+        uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            if (shard->cache.getOldestUse() < oldestUse) {
+                oldestUse = shard->cache.getOldestUse();
+                oldest = shard.get();
+            }
+        }
+        if (!oldest) {
+            return 0;
+        }
+        // the shard may be used concurrently, so its current least recently used record is evicted
+        std::lock_guard<std::mutex> lock(oldest->mutex);
+        const size_t bytes = oldest->cache.getBytes();
+        oldest->cache.evict(1);
+        return bytes - oldest->cache.getBytes();
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records currently stored in all the shards
+     * @return the number of records
+     */
+    [[nodiscard]] size_t size() const {
+        size_t result = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result += shard->cache.size();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the estimated memory footprint of the records stored in all the shards
+     * @return the sum of the costs of the records in bytes
+     */
+    [[nodiscard]] size_t getBytes() const {
+        size_t result = 0;
+        for (const auto& shard : _shards) {
+            result += shard->cache.getBytes();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from all the shards
+     * @return the number of evicted records
+     */
+    [[nodiscard]] size_t getEvictions() const {
+        size_t result = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result += shard->cache.getEvictions();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        Shard(size_t capacity, std::shared_ptr<CacheClock> clock) : cache(capacity, std::move(clock)) {}
+
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        if (_shards.size() == 1) {
+            return *_shards.front();
+        }
+        // mix the upper bits in, since the lower ones are consumed by the bucket selection inside the shard
+        const size_t hash = key.hash();
+        return *_shards[(hash ^ (hash >> 17)) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}  // namespace ov::intel_cpu
@@ -5,21 +5,28 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "memory_control.hpp"
+#include "nodes/memory.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -33,6 +40,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "plugin.h"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -81,6 +89,7 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(m_cfg.sharedWeightsDir, m_cfg.sharedWeightsPersistent, m_cfg.sharedWeightsMaxSize),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -98,7 +107,14 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                              false,
                                                                              true}
                                                   : m_cfg.streamExecutorConfig;
-        m_task_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
+        if (m_cfg.modelPrioritySetExplicitly && m_cfg.numSubStreams == 0 && !m_cfg.enableCpuReservation) {
+            // the models with a priority share the executor, so their requests are ordered in one queue. The reserved
+            // CPUs are released with the executor of the model, so such an executor is not shared
+            m_task_executor =
+                std::static_pointer_cast<const Plugin>(m_plugin)->get_priority_streams_executor(executor_config);
+        } else {
+            m_task_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
+        }
     }
     if (0 != m_cfg.streamExecutorConfig.get_streams()) {
         m_callback_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
@@ -116,6 +132,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
+    if (m_cfg.rtCacheShared) {
+        m_rtParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true, m_cfg.rtCacheByteBudget);
+        m_snippetsParamsCache =
+            std::make_shared<MultiCache>(m_cfg.snippetsCacheCapacity, true, m_cfg.rtCacheByteBudget);
+    }
+
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
@@ -202,7 +224,9 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_rtParamsCache,
+                                                         m_snippetsParamsCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -236,6 +260,11 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
                                             get_task_executor(),
                                             get_callback_executor(),
                                             m_optimized_single_stream);
+    if (m_cfg.modelPrioritySetExplicitly) {
+        ov::threading::TaskSchedulingInfo schedulingInfo;
+        schedulingInfo.priority = m_cfg.modelPriority;
+        async_infer_request->set_scheduling_info(schedulingInfo);
+    }
     if (m_has_sub_compiled_models) {
         std::vector<std::shared_ptr<IAsyncInferRequest>> requests;
         requests.reserve(m_sub_compiled_models.size());
@@ -291,6 +320,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::hint::enable_cpu_pinning.name()),
             RO_property(ov::hint::enable_cpu_reservation.name()),
             RO_property(ov::hint::scheduling_core_type.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::hint::model_distribution_policy.name()),
             RO_property(ov::hint::enable_hyper_threading.name()),
             RO_property(ov::execution_devices.name()),
@@ -352,6 +382,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const auto stream_mode = config.schedulingCoreType;
         return stream_mode;
     }
+    if (name == ov::hint::model_priority) {
+        return config.modelPriority;
+    }
     if (name == ov::hint::model_distribution_policy) {
         const auto& distribution_policy = config.modelDistributionPolicy;
         return distribution_policy;
@@ -400,9 +433,93 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::value_cache_group_size) {
         return static_cast<decltype(ov::value_cache_group_size)::value_type>(config.valueCacheGroupSize);
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type(get_runtime_cache_statistics());
+    }
+    if (name == ov::intel_cpu::intermediate_memory_statistics) {
+        return decltype(ov::intel_cpu::intermediate_memory_statistics)::value_type(
+            get_intermediate_memory_statistics());
+    }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+std::map<std::string, uint64_t> CompiledModel::get_runtime_cache_statistics() const {
+    // the shared caches are referenced by the caches of all the graphs, so count each of them only once
+    std::unordered_set<MultiCachePtr> caches;
+    MultiCache::Statistics shapeInferStats;
+    for (auto&& graph : m_graphs) {
+        // the context is set on the graph initialization
+        std::lock_guard<std::mutex> lock(graph._mutex);
+        const auto ctx = graph.getGraphContext();
+        if (!ctx) {
+            continue;
+        }
+        const auto graphShapeInferStats = graph.getShapeInferenceCacheStatistics();
+        shapeInferStats.hits += graphShapeInferStats.hits;
+        shapeInferStats.misses += graphShapeInferStats.misses;
+        shapeInferStats.evictions += graphShapeInferStats.evictions;
+        shapeInferStats.entries += graphShapeInferStats.entries;
+        for (const auto& cache : {ctx->getParamsCache(), ctx->getSnippetsParamsCache()}) {
+            caches.insert(cache);
+            if (cache->getSharedCache()) {
+                caches.insert(cache->getSharedCache());
+            }
+        }
+    }
+
+    std::map<std::string, uint64_t> result;
+    auto accumulate = [&result](const std::string& prefix, const MultiCache::Statistics& stats) {
+        result[prefix + "hits"] += stats.hits;
+        result[prefix + "misses"] += stats.misses;
+        result[prefix + "evictions"] += stats.evictions;
+        result[prefix + "entries"] += stats.entries;
+        result[prefix + "bytes"] += stats.bytes;
+    };
+
+    accumulate("", MultiCache::Statistics{});
+    for (const auto& cache : caches) {
+        accumulate("", cache->getStatistics());
+        for (const auto& [type, stats] : cache->getStatisticsPerType()) {
+            accumulate(type + ".", stats);
+        }
+    }
+    accumulate("ShapeInferenceCache.", shapeInferStats);
+
+    return result;
+}
+
+std::map<std::string, uint64_t> CompiledModel::get_intermediate_memory_statistics() const {
+    std::map<std::string, uint64_t> result{{"arena_bytes", 0},
+                                           {"lower_bound_bytes", 0},
+                                           {"fragmentation_bytes", 0},
+                                           {"reallocations", 0},
+                                           {"offloaded_states", 0},
+                                           {"offloaded_state_bytes", 0}};
+    for (size_t i = 0; i < m_graphs.size(); ++i) {
+        // the arenas are solved again by the inference of a dynamic shape graph, so the statistics are read under the
+        // graph lock
+        std::lock_guard<std::mutex> lock(m_graphs[i]._mutex);
+        const auto ctx = m_graphs[i].getGraphContext();
+        if (!ctx) {
+            continue;
+        }
+        for (const auto& [unit, stats] : ctx->getAuxiliaryNetworkMemoryControl()->getArenaStatistics()) {
+            const auto prefix = std::to_string(i) + "." + unit + ".";
+            result[prefix + "arena_bytes"] = stats.arena_size;
+            result[prefix + "lower_bound_bytes"] = stats.lower_bound;
+            result[prefix + "reallocations"] = stats.reallocations;
+            result["arena_bytes"] += stats.arena_size;
+            result["lower_bound_bytes"] += stats.lower_bound;
+            result["fragmentation_bytes"] += stats.arena_size - std::min(stats.arena_size, stats.lower_bound);
+            result["reallocations"] += stats.reallocations;
+        }
+        const auto& offloaded = ctx->getMemoryStatesRegister()->getOffloadedStatesStatistics();
+        result["offloaded_states"] += offloaded->states;
+        result["offloaded_state_bytes"] += offloaded->bytes;
+    }
+    return result;
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
     serializer << m_model;
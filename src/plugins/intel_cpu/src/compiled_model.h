@@ -5,7 +5,9 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -13,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
@@ -87,6 +90,9 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // runtime caches shared by the graphs of all the streams (if enabled)
+    MultiCachePtr m_rtParamsCache = nullptr;
+    MultiCachePtr m_snippetsParamsCache = nullptr;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,6 +100,9 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    std::map<std::string, uint64_t> get_runtime_cache_statistics() const;
+    std::map<std::string, uint64_t> get_intermediate_memory_statistics() const;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -148,6 +148,17 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::scheduling_core_type.name(),
                                ". Expected only ov::hint::SchedulingCoreType::ANY_CORE/PCORE_ONLY/ECORE_ONLY");
             }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = val.as<ov::hint::Priority>();
+                modelPrioritySetExplicitly = true;
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::hint::model_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH");
+            }
         } else if (key == ov::hint::model_distribution_policy.name()) {
             auto error_info = [&]() {
                 OPENVINO_THROW("Wrong value ",
@@ -274,6 +285,125 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_byte_budget.name() == key) {
+            try {
+                rtCacheByteBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_byte_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::dynamic_memory_growth_factor.name() == key) {
+            float val_f = 0.0F;
+            try {
+                val_f = val.as<float>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::dynamic_memory_growth_factor.name(),
+                               ". Expected only float numbers");
+            }
+            OPENVINO_ASSERT(val_f >= 1.F,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::dynamic_memory_growth_factor.name(),
+                            ". Growth factor must be not less than 1.0f");
+            dynamicMemoryGrowthFactor = val_f;
+        } else if (ov::intel_cpu::dynamic_memory_reserve.name() == key) {
+            try {
+                dynamicMemoryReserve = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::dynamic_memory_reserve.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::memory_huge_pages.name() == key) {
+            try {
+                memoryHugePages = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::memory_huge_pages.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::shape_inference_cache_capacity.name() == key) {
+            int val_i = -1;
+            try {
+                val_i = val.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shape_inference_cache_capacity.name(),
+                               ". Expected only integer numbers");
+            }
+            // any negative value is treated as zero that means disabling the cache
+            shapeInferCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::inter_op_parallelism.name() == key) {
+            try {
+                interOpParallelism = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::inter_op_parallelism.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::streams_work_stealing.name() == key) {
+            try {
+                streamsWorkStealing = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::streams_work_stealing.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::shared_weights_dir.name() == key) {
+            try {
+                sharedWeightsDir = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::shared_weights_dir.name());
+            }
+#if defined(_WIN32)
+            OPENVINO_ASSERT(sharedWeightsDir.empty(),
+                            "Property ",
+                            ov::intel_cpu::shared_weights_dir.name(),
+                            " is not supported on Windows");
+#endif
+        } else if (ov::intel_cpu::shared_weights_persistent.name() == key) {
+            try {
+                sharedWeightsPersistent = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shared_weights_persistent.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::shared_weights_max_size.name() == key) {
+            try {
+                sharedWeightsMaxSize = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shared_weights_max_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -318,7 +448,12 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             try {
                 kvCachePrecisionSetExplicitly = true;
                 const auto prec = val.as<ov::element::Type>();
-                if (any_of(prec, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8)) {
+                if (any_of(prec,
+                           ov::element::f32,
+                           ov::element::f16,
+                           ov::element::bf16,
+                           ov::element::u8,
+                           ov::element::u4)) {
                     kvCachePrecision = prec;
                 } else {
                     OPENVINO_THROW("invalid value");
@@ -328,7 +463,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::hint::kv_cache_precision.name(),
-                               ". Supported values: u8, bf16, f16, f32");
+                               ". Supported values: u4, u8, bf16, f16, f32");
             }
         } else if (key == ov::key_cache_precision.name()) {
             try {
@@ -350,7 +485,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::key_cache_precision.name(),
-                               ". Supported values: u8, bf16, f16, f32");
+                               ". Supported values: u4, u8, i8, bf16, f16, f32");
             }
         } else if (key == ov::value_cache_precision.name()) {
             try {
@@ -457,6 +592,14 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             OPENVINO_THROW("NotFound: Unsupported property ", key, " by CPU plugin.");
         }
     }
+    // both select the task queue of the streams executor
+    if (modelPrioritySetExplicitly && streamsWorkStealing) {
+        OPENVINO_THROW(ov::hint::model_priority.name(),
+                       " can't be set together with ",
+                       ov::intel_cpu::streams_work_stealing.name(),
+                       ": the requests ordered by priority are kept in a single queue of the CPU streams executor");
+    }
+
     // apply execution mode after all the params are handled to prevent possible conflicts
     // when both execution_mode and inference_precision are specified
     if (!inferencePrecisionSetExplicitly) {
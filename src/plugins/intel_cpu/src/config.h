@@ -72,6 +72,17 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    size_t rtCacheByteBudget = 0UL;
+    std::string sharedWeightsDir;
+    bool sharedWeightsPersistent = false;
+    uint64_t sharedWeightsMaxSize = 0;
+    float dynamicMemoryGrowthFactor = 1.0F;
+    bool dynamicMemoryReserve = false;
+    bool memoryHugePages = false;
+    bool interOpParallelism = false;
+    bool streamsWorkStealing = false;
+    size_t shapeInferCacheCapacity = 0UL;
 #if defined(OPENVINO_ARCH_X86_64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -100,6 +111,8 @@ struct Config {
     bool changedCpuPinning = false;
     bool enableCpuReservation = false;
     ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+    bool modelPrioritySetExplicitly = false;
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy;
     bool enableTensorParallel = false;
     int streamsRankLevel = 1;
@@ -125,6 +138,10 @@ struct Config {
     // is reserved.
     bool DAZOn = false;
 
+    // f32 constants are known to contain neither subnormals nor values overflowing bf16,
+    // it is the case for the models imported from the plugin blob
+    bool constantsVerified = false;
+
     void readProperties(const ov::AnyMap& prop, ModelType modelType = ModelType::Unknown);
 
     void updateProperties();
@@ -786,6 +786,14 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                 config.enableCpuReservation,
                                                 streams_info_table);
 
+    // the explicit model priority orders the requests in a single queue, Config::readProperties() rejects it together
+    // with work stealing
+    auto taskQueueType = IStreamsExecutor::Config::TaskQueueType::SHARED;
+    if (config.modelPrioritySetExplicitly) {
+        taskQueueType = IStreamsExecutor::Config::TaskQueueType::PRIORITY;
+    } else if (config.streamsWorkStealing) {
+        taskQueueType = IStreamsExecutor::Config::TaskQueueType::WORK_STEALING;
+    }
     config.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor",
                                                            config.streams,
                                                            config.threadsPerStream,
@@ -795,7 +803,8 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                            true,
                                                            std::move(streams_info_table),
                                                            {},
-                                                           false};
+                                                           false,
+                                                           taskQueueType};
     return proc_type_table;
 }
 
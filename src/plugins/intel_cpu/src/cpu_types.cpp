@@ -243,6 +243,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"MulticlassNms", Type::MulticlassNms},
         {"MulticlassNmsIEInternal", Type::MulticlassNms},
         {"Multinomial", Type::Multinomial},
+        {"Sampling", Type::Multinomial},
         {"Reference", Type::Reference},
         {"Subgraph", Type::Subgraph},
         {"SubModel", Type::SubModel},
@@ -18,6 +18,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -28,7 +29,9 @@
 #include "memory_desc/dnnl_memory_desc.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "utils/sha256.hpp"
 #if defined(OV_CPU_WITH_ACL) || defined(OPENVINO_ARCH_X86_64)
 #    include "utils/general_utils.h"
 #endif
@@ -244,6 +247,23 @@ std::string DnnlExtensionUtils::query_impl_info_str(const const_dnnl_primitive_d
     return res;
 }
 
+size_t DnnlExtensionUtils::query_primitive_cost(const const_dnnl_primitive_desc_t& pd) {
+    dnnl_dim_t consumption = 0;
+    if (dnnl_primitive_desc_query(pd, dnnl_query_memory_consumption_s64, 0, &consumption) != dnnl_success) {
+        consumption = 0;
+    }
+    const auto* scratchpad = dnnl_primitive_desc_query_md(pd, dnnl_query_scratchpad_md, 0);
+    return static_cast<size_t>(consumption) + (scratchpad ? dnnl_memory_desc_get_size(scratchpad) : 0);
+}
+
+const dnnl::stream& DnnlExtensionUtils::threadStream(const dnnl::engine& engine) {
+    thread_local dnnl::stream stream;
+    if (!stream || stream.get_engine() != engine) {
+        stream = dnnl::stream(engine);
+    }
+    return stream;
+}
+
 bool DnnlExtensionUtils::find_implementation(dnnl::primitive_desc& desc, impl_desc_type impl_type) {
     return DnnlExtensionUtils::find_implementation(desc, [impl_type](impl_desc_type cur_impl_type) {
         return cur_impl_type == impl_type;
@@ -306,4 +326,33 @@ std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<c
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+std::string DnnlExtensionUtils::computeWeightsContentHash(const std::shared_ptr<const IMemory>& memory,
+                                                          const std::shared_ptr<DnnlMemoryDesc>& srcDesc,
+                                                          const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    constexpr size_t chunkSize = 1 << 20;
+    const auto* data = memory->getDataAs<const uint8_t>();
+    const size_t size = memory->getSize();
+    const size_t chunksNum = (size + chunkSize - 1) / chunkSize;
+
+    // the key maps the record of another process, so a collision would silently substitute the weights of another
+    // model. Fixed size chunks are hashed independently, so the result does not depend on the number of threads, and
+    // the digest of the source is the digest of the size followed by the chunk digests
+    std::vector<Sha256::Digest> chunkDigests(chunksNum);
+    parallel_for(chunksNum, [&](size_t i) {
+        const size_t begin = i * chunkSize;
+        chunkDigests[i] = Sha256::digest(data + begin, std::min(size, begin + chunkSize) - begin);
+    });
+
+    Sha256 sha;
+    const auto size64 = static_cast<uint64_t>(size);
+    sha.update(&size64, sizeof(size64));
+    sha.update(chunkDigests.data(), chunkDigests.size() * sizeof(Sha256::Digest));
+
+    std::stringstream ss;
+    ss << std::hex << dnnl::impl::primitive_hashing::get_md_hash(*srcDesc->getDnnlDesc().get()) << "_"
+       << dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get()) << "_"
+       << Sha256::toHex(sha.finalize());
+    return ss.str();
+}
+
 }  // namespace ov::intel_cpu
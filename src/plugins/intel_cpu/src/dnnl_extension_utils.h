@@ -76,6 +76,16 @@ public:
                                                     const dnnl::query& what,
                                                     int idx = 0);
     static std::string query_impl_info_str(const const_dnnl_primitive_desc_t& pd);
+    /**
+     * @brief Estimates the memory required by the primitive created from the descriptor: the memory held by the
+     * primitive itself and its scratchpad. Used as the cost of the primitive stored in the runtime cache.
+     */
+    static size_t query_primitive_cost(const const_dnnl_primitive_desc_t& pd);
+    /**
+     * @brief Returns the stream of the calling thread for the engine. The primitives shared by the CPU streams of a
+     * compiled model may be executed concurrently, so they don't keep a stream of their own.
+     */
+    static const dnnl::stream& threadStream(const dnnl::engine& engine);
 
     template <typename T>
     static bool find_implementation(dnnl::primitive_desc& desc, T&& comparator) {
@@ -130,6 +140,18 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes weights string hash based on the weights content, so the hash is the same in different processes.
+     * The content is identified by its SHA-256 digest, since the hash selects the weights shared with other processes
+     * @param memory Weights memory pointer
+     * @param srcDesc descriptor defining weights representation before repacking
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return string hash
+     */
+    static std::string computeWeightsContentHash(const std::shared_ptr<const IMemory>& memory,
+                                                 const std::shared_ptr<DnnlMemoryDesc>& srcDesc,
+                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
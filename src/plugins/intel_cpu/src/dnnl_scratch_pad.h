@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -19,6 +20,7 @@ class DnnlScratchPad {
     MemoryBlockPtr blockPtr;
     MemoryBlockWithReuse* baseBlockPtr = nullptr;
     dnnl::engine eng;
+    std::atomic<size_t> requests{0};
 
 public:
     explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
@@ -28,6 +30,7 @@ public:
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        requests.fetch_add(1, std::memory_order_relaxed);
         return std::make_shared<Memory>(eng, md, blockPtr);
     }
 
@@ -37,6 +40,11 @@ public:
         }
         return 0;
     }
+
+    // the number of the scratch pad memory objects created so far, allows to find out whether an action uses the pad
+    [[nodiscard]] size_t requestsNum() const {
+        return requests.load(std::memory_order_relaxed);
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "common/primitive_hashing_utils.hpp"
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "edge.h"
@@ -81,6 +82,8 @@
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #    include <tbb/task.h>
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
 #endif
 
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -329,6 +332,70 @@ static std::vector<size_t> IdentifySyncPoints(const std::vector<NodePtr>& graphN
     return syncNodesInds;
 }
 
+/**
+ * Identifies the nodes whose output shapes are determined by the graph input shapes only, so the shape inference
+ * results of such nodes may be memoized by the input shapes.
+ * The output values of a node are considered determined by the input shapes if the node is constant, is ShapeOf or
+ * computes the values from the determined ones. A node with the data dependent shape inference has the determined
+ * output shapes only if the values of the corresponding inputs are determined.
+ */
+static std::vector<bool> IdentifyShapeInferMemoizableNodes(const std::vector<NodePtr>& graphNodes,
+                                                           const std::vector<NodePtr>& executableGraphNodes) {
+    std::unordered_set<NodePtr> shapeDetermined;
+    std::unordered_set<NodePtr> valueDetermined;
+
+    // nodes are expected to be topologically sorted
+    for (const auto& node : graphNodes) {
+        if (node->isConstant()) {
+            shapeDetermined.insert(node);
+            valueDetermined.insert(node);
+            continue;
+        }
+        if (node->getType() == Type::Input) {
+            shapeDetermined.insert(node);
+            continue;
+        }
+        // the output shapes of the stateful nodes and the nodes with inner graphs depend on more than the inputs
+        if (any_of(node->getType(), Type::MemoryInput, Type::If, Type::TensorIterator, Type::Reference)) {
+            continue;
+        }
+
+        bool shapes = true;
+        bool parentShapes = true;
+        bool values = none_of(node->getType(), Type::RandomUniform, Type::Multinomial);
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            const bool parentShape = shapeDetermined.count(parent) > 0;
+            const bool parentValue = valueDetermined.count(parent) > 0;
+            parentShapes &= parentShape;
+            shapes &= parentShape && (parentValue || !node->shapeInferDataDependency(i));
+            values &= parentValue;
+        }
+
+        if (shapes) {
+            shapeDetermined.insert(node);
+        }
+        if (node->getType() == Type::ShapeOf ? parentShapes : shapes && values) {
+            valueDetermined.insert(node);
+        }
+    }
+
+    std::vector<bool> memoizable(executableGraphNodes.size(), false);
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto& node = executableGraphNodes[i];
+        // the nodes keeping the shape inference side results (i.e. auto padding) cannot skip the shape inference
+        memoizable[i] = node->isDynamicNode() && shapeDetermined.count(node) > 0 &&
+                        none_of(node->getType(),
+                                Type::Convolution,
+                                Type::Deconvolution,
+                                Type::DeformableConvolution,
+                                Type::Pooling,
+                                Type::Subgraph);
+    }
+
+    return memoizable;
+}
+
 static std::tuple<std::vector<NodePtr>, std::vector<size_t>> ExtractExecutableNodesAndSyncPoints(
     const std::vector<size_t>& syncNodesInds,
     const std::vector<NodePtr>& graphNodes) {
@@ -526,7 +593,15 @@ void Graph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
-void Graph::CreatePrimitivesAndExecConstants() const {
+static size_t ScratchPadRequests(const GraphContext::CPtr& context) {
+    size_t result = 0;
+    for (const auto& scratchPad : context->getScratchPads()) {
+        result += scratchPad->requestsNum();
+    }
+    return result;
+}
+
+void Graph::CreatePrimitivesAndExecConstants() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
 
@@ -553,11 +628,17 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // the nodes sharing the scratch pad cannot be executed concurrently
+    std::unordered_set<NodePtr> scratchPadUsers;
     for (const auto& node : graphNodes) {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
+            const auto scratchPadRequests = ScratchPadRequests(m_context);
             node->createPrimitive();
+            if (ScratchPadRequests(m_context) != scratchPadRequests) {
+                scratchPadUsers.insert(node);
+            }
         }
 
         if (!node->isConstant() || !node->isExecutable()) {
@@ -568,16 +649,18 @@ void Graph::CreatePrimitivesAndExecConstants() const {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNodeWithCatch(node);
+                ExecuteNodeWithCatch(node, m_stream);
 
                 for (auto& output : std::get<2>(sharedOutputs)) {
                     output->valid(true);
                 }
             }
         } else {
-            ExecuteNodeWithCatch(node);
+            ExecuteNodeWithCatch(node, m_stream);
         }
     }
+
+    ExcludeFromExecutionWaves(scratchPadUsers);
 }
 
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc,
@@ -896,6 +979,19 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     std::tie(m_executableGraphNodes, m_executableSyncNodesInds) =
         ExtractExecutableNodesAndSyncPoints(syncNodesInds, graphNodes);
 
+    m_outputShapesMemo.assign(m_executableGraphNodes.size(), nullptr);
+    m_currentShapeInferMemo.reset();
+    m_shapeInferMemoizable.clear();
+    m_shapeInferMemo = decltype(m_shapeInferMemo)(0);
+    if (hasDynNodes && getConfig().shapeInferCacheCapacity > 0) {
+        m_shapeInferMemoizable = IdentifyShapeInferMemoizableNodes(graphNodes, m_executableGraphNodes);
+        if (std::any_of(m_shapeInferMemoizable.begin(), m_shapeInferMemoizable.end(), [](bool memoizable) {
+                return memoizable;
+            })) {
+            m_shapeInferMemo = decltype(m_shapeInferMemo)(getConfig().shapeInferCacheCapacity);
+        }
+    }
+
     if (hasDynNodes) {
         status = Status::ReadyDynamic;
         // Here we use the following heuristic: if the number of sync nodes is less than 10 times of the number of exec
@@ -914,6 +1010,169 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     return syncNodesInds;
 }
 
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+// the node is worth executing concurrently with the neighbours only if it is too small to occupy all the threads
+static constexpr size_t interOpWorkPerThread = 16 * 1024;
+
+static bool CanBeExecutedConcurrently(const NodePtr& node, const GlobalExecutionIndex& execIndex, size_t maxWork) {
+    // the stateful nodes and the nodes capturing the shared scratch pad are executed alone
+    if (any_of(node->getType(),
+               Type::Input,
+               Type::Output,
+               Type::MemoryInput,
+               Type::MemoryOutput,
+               Type::Reference,
+               Type::ScaledDotProductAttention,
+               Type::PagedAttention,
+               Type::LLMMLP,
+               Type::QKVProjection)) {
+        return false;
+    }
+    // as well as the nodes with inner graphs
+    const auto& [inputExecIndex, outputExecIndex] = execIndex.at(node);
+    if (inputExecIndex != outputExecIndex) {
+        return false;
+    }
+    // the inplace memory may be modified while being read by a neighbour
+    size_t work = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        const auto edge = node->getParentEdgeAt(i);
+        if (edge->inPlace()) {
+            return false;
+        }
+        work += edge->getOriginalDesc().getShape().getElementsCount();
+    }
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        if (edge->inPlace()) {
+            return false;
+        }
+        work += edge->getOriginalDesc().getShape().getElementsCount();
+    }
+
+    return work <= maxWork;
+}
+
+// the nodes executed before the wave (which have smaller execution indices) are not traversed
+static bool DependsOnWave(const NodePtr& node, const std::unordered_set<NodePtr>& wave, int waveExecIndex) {
+    if (wave.empty()) {
+        return false;
+    }
+
+    std::vector<NodePtr> toVisit{node};
+    std::unordered_set<NodePtr> visited;
+    while (!toVisit.empty()) {
+        const auto current = toVisit.back();
+        toVisit.pop_back();
+        for (size_t i = 0; i < current->getParentEdges().size(); i++) {
+            const auto parent = current->getParentEdgeAt(i)->getParent();
+            if (wave.count(parent) > 0) {
+                return true;
+            }
+            if (parent->getExecIndex() >= waveExecIndex && visited.insert(parent).second) {
+                toVisit.push_back(parent);
+            }
+        }
+    }
+
+    return false;
+}
+#endif
+
+/**
+ * Forms the waves of the independent executable nodes to be executed concurrently
+ * The waves are the ranges of the execution order, so the inplace conflicts resolved for this order stay valid.
+ * The lifetime of the memory of a wave node is prolonged to the whole wave, so the memory is never reused inside it.
+ */
+void Graph::FormExecutionWaves([[maybe_unused]] AllocationContext& allocationContext) {
+    m_executionWaves.clear();
+    m_executionWavesChecked = false;
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const auto threadsNum = static_cast<size_t>(parallel_get_max_threads());
+    if (!getConfig().interOpParallelism || status != Status::ReadyStatic || threadsNum < 2) {
+        return;
+    }
+
+    const size_t maxWork = threadsNum * interOpWorkPerThread;
+    std::unordered_set<NodePtr> wave;
+    size_t waveBegin = 0;
+    auto closeWave = [&](size_t waveEnd) {
+        if (wave.size() > 1) {
+            m_executionWaves.emplace_back(waveBegin, waveEnd);
+        }
+        wave.clear();
+        waveBegin = waveEnd;
+    };
+
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        const auto& node = m_executableGraphNodes[i];
+        // inplace nodes do nothing on execution, so they do not break the wave
+        if (!node->isExecutable()) {
+            continue;
+        }
+        if (!CanBeExecutedConcurrently(node, allocationContext.execIndex, maxWork)) {
+            closeWave(i);
+            waveBegin = i + 1;
+            continue;
+        }
+        if (wave.size() == threadsNum ||
+            DependsOnWave(node, wave, m_executableGraphNodes[waveBegin]->getExecIndex())) {
+            closeWave(i);
+        }
+        wave.insert(node);
+    }
+    closeWave(m_executableGraphNodes.size());
+
+    for (const auto& [begin, end] : m_executionWaves) {
+        const int waveInputExecIndex = allocationContext.execIndex.at(m_executableGraphNodes[begin]).first;
+        const int waveOutputExecIndex = allocationContext.execIndex.at(m_executableGraphNodes[end - 1]).second;
+        for (size_t i = begin; i < end; i++) {
+            const auto& node = m_executableGraphNodes[i];
+            if (!node->isExecutable()) {
+                continue;
+            }
+            allocationContext.execIndex[node] = {waveInputExecIndex, waveOutputExecIndex};
+            allocationContext.concurrentNodes.insert(node);
+        }
+    }
+
+    m_waveStreams.clear();
+    for (size_t i = 0; i < threadsNum && !m_executionWaves.empty(); i++) {
+        m_waveStreams.emplace_back(getEngine());
+    }
+    DEBUG_LOG("Graph ", GetName(), " has ", m_executionWaves.size(), " execution waves");
+#endif
+}
+
+void Graph::ExcludeFromExecutionWaves(const std::unordered_set<NodePtr>& nodes) {
+    if (nodes.empty() || m_executionWaves.empty()) {
+        return;
+    }
+
+    // the excluded nodes are executed alone, the rest of the wave is split around them
+    std::vector<std::pair<size_t, size_t>> executionWaves;
+    for (const auto& [begin, end] : m_executionWaves) {
+        size_t subWaveBegin = begin;
+        size_t subWaveSize = 0;
+        for (size_t i = begin; i < end; i++) {
+            const auto& node = m_executableGraphNodes[i];
+            if (nodes.count(node) == 0) {
+                subWaveSize += node->isExecutable() ? 1 : 0;
+                continue;
+            }
+            if (subWaveSize > 1) {
+                executionWaves.emplace_back(subWaveBegin, i);
+            }
+            subWaveBegin = i + 1;
+            subWaveSize = 0;
+        }
+        if (subWaveSize > 1) {
+            executionWaves.emplace_back(subWaveBegin, end);
+        }
+    }
+    m_executionWaves = std::move(executionWaves);
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -1043,7 +1302,9 @@ static void ValidateEdgeClusters(const EdgeClusters& clusters, size_t remaining)
 
 static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                        size_t remaining,
-                                       const GlobalExecutionIndex& globalExecIndex) {
+                                       const AllocationContext& allocationContext) {
+    const auto& globalExecIndex = allocationContext.execIndex;
+
     auto isConstOutput = [](const EdgePtr& edge) {
         return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
     };
@@ -1058,9 +1319,11 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                             0,
                             static_cast<int64_t>(i),
                             MemoryRegion::RegionType::VARIABLE,
-                            MemoryRegion::AllocType::UNKNOWN};
+                            MemoryRegion::AllocType::UNKNOWN,
+                            -1};
 
         int64_t boxSize = 0;
+        int64_t maxBoxSize = 0;
         bool isConst = false;
         bool isOutput = false;
         bool isInput = false;
@@ -1069,14 +1332,15 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
             const auto& parent = edge->getParent();
             const auto& child = edge->getChild();
 
-            auto usesInOutMemoryMultipleTimes = [](const NodePtr& node) {
+            auto usesInOutMemoryMultipleTimes = [&allocationContext](const NodePtr& node) {
                 if (auto tensorIterator = std::dynamic_pointer_cast<node::TensorIterator>(node)) {
                     return tensorIterator->usesInOutMemoryMultipleTimes();
                 }
 
-                return false;
+                return allocationContext.concurrentNodes.count(node) > 0;
             };
             // If node uses its input / output memory multiple times in scope of a single execution (i.e TensorIterator)
+            // or is executed concurrently with the neighbours
             // prolong the lifetime of a memory region till execution is finished
             int e_start = usesInOutMemoryMultipleTimes(parent) ? globalExecIndex.at(parent).first
                                                                : globalExecIndex.at(parent).second;
@@ -1093,6 +1357,12 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                 boxSize = -1;
             }
 
+            if (maxBoxSize != -1 && desc.hasDefinedMaxSize()) {
+                maxBoxSize = std::max(static_cast<int64_t>(desc.getMaxMemSize()), maxBoxSize);
+            } else {
+                maxBoxSize = -1;
+            }
+
             reg.start = std::min(e_start, reg.start);
             reg.finish = std::max(e_finish, reg.finish);
 
@@ -1109,6 +1379,7 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
         }
 
         reg.size = boxSize;
+        reg.max_size = boxSize == -1 ? maxBoxSize : boxSize;
 
         if (isConst) {
             reg.type = MemoryRegion::RegionType::CONSTANT;
@@ -1164,7 +1435,7 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     Graph::OutputMemoryBlocks outputNodesMemBlocks;
     std::tie(remaining, outputNodesMemBlocks) = AllocateDynamicOutputEdges(edgeClusters, remaining, outputNodes);
 
-    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex);
+    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext);
 
     memoryControl->insert(memoryRegions, allocationContext.syncPoints);
     auto memoryBlocks = memoryControl->solve();
@@ -1181,6 +1452,7 @@ void Graph::Allocate() {
 
     AllocationContext allocationContext;
     RegisterToAllocationContext(0, allocationContext);
+    FormExecutionWaves(allocationContext);
 
     const auto& edges = allocationContext.edges;
     InitEdgeStatus(edges);
@@ -1354,23 +1626,79 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
 }
 
 void Graph::InferStatic(SyncInferRequest* request, int numaId) {
+    if (!m_executionWaves.empty()) {
+        InferStaticWaves(request, numaId);
+        return;
+    }
+
     for (const auto& node : m_executableGraphNodes) {
-        ExecuteNodeWithCatch(node, request, numaId);
+        ExecuteNodeWithCatch(node, m_stream, request, numaId);
+    }
+}
+
+void Graph::InferStaticWaves(SyncInferRequest* request, int numaId) {
+    if (!m_executionWavesChecked) {
+        // the first execution is sequential to find out the nodes requesting the scratch pad lazily
+        std::unordered_set<NodePtr> scratchPadUsers;
+        for (const auto& node : m_executableGraphNodes) {
+            const auto scratchPadRequests = ScratchPadRequests(m_context);
+            ExecuteNodeWithCatch(node, m_stream, request, numaId);
+            if (ScratchPadRequests(m_context) != scratchPadRequests) {
+                scratchPadUsers.insert(node);
+            }
+        }
+        ExcludeFromExecutionWaves(scratchPadUsers);
+        m_executionWavesChecked = true;
+        return;
+    }
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    size_t nodeIdx = 0;
+    for (const auto& [begin, end] : m_executionWaves) {
+        for (; nodeIdx < begin; nodeIdx++) {
+            ExecuteNodeWithCatch(m_executableGraphNodes[nodeIdx], m_stream, request, numaId);
+        }
+
+        tbb::task_group waveTasks;
+        size_t lane = 0;
+        for (; nodeIdx < end; nodeIdx++) {
+            const auto& node = m_executableGraphNodes[nodeIdx];
+            if (!node->isExecutable()) {
+                ExecuteNodeWithCatch(node, m_stream, request, numaId);
+                continue;
+            }
+            const auto& strm = m_waveStreams[lane++];
+            waveTasks.run([this, &node, &strm, request, numaId]() {
+                // prevent the threads waiting inside the node from picking up the tasks of the other wave nodes
+                tbb::this_task_arena::isolate([&]() {
+                    ExecuteNodeWithCatch(node, strm, request, numaId);
+                });
+            });
+        }
+        waveTasks.wait();
     }
+
+    for (; nodeIdx < m_executableGraphNodes.size(); nodeIdx++) {
+        ExecuteNodeWithCatch(m_executableGraphNodes[nodeIdx], m_stream, request, numaId);
+    }
+#else
+    OPENVINO_THROW("Execution waves are supported only with TBB threading");
+#endif
 }
 
 namespace {
 
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, std::vector<std::vector<VectorDims>*>& outputShapesMemo)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_outputShapesMemo(outputShapesMemo) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                node->updateShapes(m_outputShapesMemo[prepareCounter]);
                 node->updateDynamicParams();
             }
         }
@@ -1379,6 +1707,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    std::vector<std::vector<VectorDims>*>& m_outputShapesMemo;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1389,14 +1718,15 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, std::vector<std::vector<VectorDims>*>& outputShapesMemo)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_outputShapesMemo(outputShapesMemo) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    node->updateShapes(m_outputShapesMemo[i]);
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1429,6 +1759,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    std::vector<std::vector<VectorDims>*>& m_outputShapesMemo;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1600,19 +1931,25 @@ public:
     OV_ITT_SCOPED_TASK(ittScope, (node)->profiling.execute);    \
     DEBUG_LOG(*(node));
 
-inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& strm,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(strm, numaId);
 }
 
-inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& strm,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::intel_cpu, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, strm, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -1620,6 +1957,46 @@ inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* r
     }
 }
 
+size_t Graph::InputShapesKey::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& inputDims : dims) {
+        seed = get_vector_hash(seed, inputDims);
+    }
+    return seed;
+}
+
+void Graph::UpdateOutputShapesMemo() {
+    if (m_shapeInferMemo.getCapacity() == 0) {
+        return;
+    }
+
+    InputShapesKey key;
+    key.dims.reserve(inputNodes.size());
+    for (const auto& inputNode : inputNodes) {
+        if (inputNode && !inputNode->getChildEdges().empty()) {
+            key.dims.push_back(inputNode->getChildEdgeAt(0)->getMemory().getStaticDims());
+        } else {
+            key.dims.emplace_back();
+        }
+    }
+
+    m_currentShapeInferMemo = m_shapeInferMemo.get(key);
+    if (m_currentShapeInferMemo) {
+        m_shapeInferMemoHits++;
+    } else {
+        // the shapes are memoized by the shape inference of the nodes on the way
+        m_shapeInferMemoMisses++;
+        m_currentShapeInferMemo = std::make_shared<OutputShapesMemo>(m_executableGraphNodes.size());
+        m_shapeInferMemo.put(key, m_currentShapeInferMemo);
+    }
+
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        m_outputShapesMemo[i] = m_shapeInferMemoizable[i] ? &(*m_currentShapeInferMemo)[i] : nullptr;
+    }
+}
+
 template <typename UpdateStrategy>
 void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update) {
     size_t inferCounter = 0;
@@ -1629,7 +2006,7 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = m_executableGraphNodes[inferCounter];
 
-            ExecuteNodeWithCatch(node, request, numaId);
+            ExecuteNodeWithCatch(node, m_stream, request, numaId);
         }
     }
 }
@@ -1653,10 +2030,12 @@ void Graph::Infer(SyncInferRequest* request) {
 
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        UpdateOutputShapesMemo();
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, m_outputShapesMemo));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        UpdateOutputShapesMemo();
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, m_outputShapesMemo));
         break;
     case Status::ReadyStatic:
         InferStatic(request, numaId);
@@ -1764,6 +2143,19 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
         }
         getPerfMapFor(perfMap, graphNode);
     }
+
+    // the intermediate memory of dynamic graphs may be reallocated on the inference hot path, so the number of the
+    // reallocations is reported as a separate row per memory control unit, which is never executed as a node
+    if (IsDynamic()) {
+        for (const auto& [id, stats] : m_context->getAuxiliaryNetworkMemoryControl()->getArenaStatistics()) {
+            ov::ProfilingInfo pc;
+            pc.node_name = "MemoryControl_" + id;
+            pc.status = ov::ProfilingInfo::Status::NOT_RUN;
+            pc.exec_type = "reallocations_" + std::to_string(stats.reallocations);
+            pc.node_type = "MemoryReallocations";
+            perfMap.emplace_back(pc);
+        }
+    }
 }
 
 void Graph::CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort, int childPort) {
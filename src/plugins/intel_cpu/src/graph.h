@@ -11,10 +11,14 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cache/cache_entry.h"
+#include "cache/lru_cache.h"
 #include "config.h"
+#include "cpu_types.h"
 #include "edge.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -108,6 +112,11 @@ public:
         return _name;
     }
 
+    // lookups of the output shapes memoized by the graph input shapes
+    [[nodiscard]] CacheEntryBase::Statistics getShapeInferenceCacheStatistics() const {
+        return {m_shapeInferMemoHits, m_shapeInferMemoMisses, m_shapeInferMemo.getEvictions(), m_shapeInferMemo.size()};
+    }
+
     NodePtr getInputNodeByIndex(std::size_t index) {
         if (index >= inputNodes.size()) {
             return nullptr;
@@ -297,6 +306,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_executionWaves.clear();
     }
     Status status{Status::NotReady};
 
@@ -326,29 +336,41 @@ protected:
     void ResolveComplexInplaceConflicts();
     bool ProcessDynNodes() const;
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
-    void CreatePrimitivesAndExecConstants() const;
+    void CreatePrimitivesAndExecConstants();
     std::vector<size_t> CreateExecutionGraph();
+    void FormExecutionWaves(AllocationContext& allocationContext);
+    void ExcludeFromExecutionWaves(const std::unordered_set<NodePtr>& nodes);
 
     /**
      * Execute a given \p node within \p request using \p numaId
      * and catch possible exceptions to include extra information
      *
      * @params node     Node to execute
+     * @params strm     Stream to execute the node on
      * @params request  Current inference request, which is checked for cancelation
      * @params numaId   Numa Id to be used for an execution
      */
-    void ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& strm,
+                              SyncInferRequest* request = nullptr,
+                              int numaId = -1) const;
 
     /**
      * Execute a given \p node within \p request using \p numaId
      *
      * @params node     Node to execute
+     * @params strm     Stream to execute the node on
      * @params request  Current inference request, which is checked for cancelation
      * @params numaId   Numa Id to be used for an execution
      */
-    void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNode(const NodePtr& node,
+                     const dnnl::stream& strm,
+                     SyncInferRequest* request = nullptr,
+                     int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticWaves(SyncInferRequest* request, int numaId);
+    void UpdateOutputShapesMemo();
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -372,6 +394,31 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    // [begin, end) ranges of m_executableGraphNodes executed concurrently when the inter-op parallelism is enabled
+    std::vector<std::pair<size_t, size_t>> m_executionWaves;
+    // whether the nodes requesting the scratch pad during the first execution are excluded from the waves
+    bool m_executionWavesChecked = false;
+    // the concurrent nodes do not share a stream
+    std::vector<dnnl::stream> m_waveStreams;
+
+    struct InputShapesKey {
+        std::vector<VectorDims> dims;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const InputShapesKey& rhs) const {
+            return dims == rhs.dims;
+        }
+    };
+    // output shapes per executable node
+    using OutputShapesMemo = std::vector<std::vector<VectorDims>>;
+    LruCache<InputShapesKey, std::shared_ptr<OutputShapesMemo>> m_shapeInferMemo{0};
+    std::shared_ptr<OutputShapesMemo> m_currentShapeInferMemo;
+    // whether the output shapes of the executable node are determined by the graph input shapes only
+    std::vector<bool> m_shapeInferMemoizable;
+    // the output shapes memoized for the current input shapes per executable node, null if not memoizable
+    std::vector<std::vector<VectorDims>*> m_outputShapesMemo;
+    size_t m_shapeInferMemoHits = 0;
+    size_t m_shapeInferMemoMisses = 0;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
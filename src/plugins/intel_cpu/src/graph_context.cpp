@@ -25,17 +25,25 @@ GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr paramsCache,
+                           MultiCachePtr snippetsParamsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_rtParamsCache(
+          std::make_shared<MultiCache>(m_config.rtCacheCapacity, std::move(paramsCache), m_config.rtCacheByteBudget)),
+      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity,
+                                                         std::move(snippetsParamsCache),
+                                                         m_config.rtCacheByteBudget)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(
+          std::make_shared<NetworkMemoryControl>(DynamicMemoryPolicy{m_config.dynamicMemoryGrowthFactor,
+                                                                     m_config.dynamicMemoryReserve,
+                                                                     m_config.memoryHugePages})),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -35,7 +35,9 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr paramsCache = nullptr,
+                 MultiCachePtr snippetsParamsCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -108,7 +110,7 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache, the thread safe values may be stored in a cache shared between the streams of a compiled model
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
     // global scratch pad
@@ -147,6 +147,17 @@ std::shared_ptr<ov::Model> dump_graph_as_ie_ngraph_net(const Graph& graph) {
     std::map<std::size_t, std::shared_ptr<op::v0::Parameter>> paramsMap;
     std::map<std::size_t, std::shared_ptr<ov::op::v0::Result>> resultsMap;
 
+    // the nodes executed concurrently by the inter-op parallelism share the wave
+    std::map<NodePtr, std::size_t> node2wave;
+    for (std::size_t wave = 0; wave < graph.m_executionWaves.size(); wave++) {
+        const auto& [begin, end] = graph.m_executionWaves[wave];
+        for (std::size_t i = begin; i < end; i++) {
+            if (graph.m_executableGraphNodes[i]->isExecutable()) {
+                node2wave[graph.m_executableGraphNodes[i]] = wave;
+            }
+        }
+    }
+
     auto get_inputs = [&](const NodePtr& node) {
         auto pr_edges = node->getParentEdges();
         ov::OutputVector inputs(pr_edges.size());
@@ -177,6 +188,9 @@ std::shared_ptr<ov::Model> dump_graph_as_ie_ngraph_net(const Graph& graph) {
         bool should_be_hold = !is_output && node->getChildEdges().empty();
 
         auto meta_data = extract_node_metadata(node);
+        if (auto wave = node2wave.find(node); wave != node2wave.end()) {
+            meta_data["execWave"] = std::to_string(wave->second);
+        }
         std::shared_ptr<ov::Node> return_node;
         if (is_input) {
             const auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
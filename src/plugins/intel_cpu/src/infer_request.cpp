@@ -319,11 +319,23 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
 
 std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const {
     if (m_asyncRequest->m_has_sub_infers) {
+        // every sub-stream has its own copy of each state, and the KV cache states hold only the heads of their
+        // sub-stream, so the copies of a state are combined into the single state of the full shape
         auto requests = m_asyncRequest->getSubInferRequest();
-        std::vector<ov::SoPtr<ov::IVariableState>> states;
+        std::vector<std::vector<ov::SoPtr<ov::IVariableState>>> subStates;
         for (const auto& request : requests) {
             auto cur = request->query_state();
-            states.insert(states.end(), cur.begin(), cur.end());
+            subStates.resize(cur.size());
+            for (size_t i = 0; i < cur.size(); i++) {
+                OPENVINO_ASSERT(subStates[i].empty() || subStates[i][0]->get_name() == cur[i]->get_name(),
+                                "The states of the tensor parallel sub-streams do not match");
+                subStates[i].push_back(cur[i]);
+            }
+        }
+        std::vector<ov::SoPtr<ov::IVariableState>> states;
+        states.reserve(subStates.size());
+        for (auto& state : subStates) {
+            states.emplace_back(std::make_shared<VariableStateTensorParallel>(std::move(state)));
         }
         return states;
     }
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,116 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether a single CPU runtime parameters cache is shared by all the streams of a compiled model, so the
+ * same values are built only once instead of once per stream. Only the value types marked as thread safe are shared,
+ * the other ones stay in the caches of the streams.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Defines the limit of the estimated memory footprint in bytes of the records stored in each CPU runtime
+ * parameters cache (the cache of a stream or the one shared by the streams). The footprint of a oneDNN primitive is the
+ * memory it holds plus its scratchpad, the one of a snippet is its generated code. When the limit is exceeded, the
+ * least recently used records are evicted whatever their type is. Zero (default) means no limit, so only the number of
+ * records is bounded by cpu_runtime_cache_capacity.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_runtime_cache_byte_budget{
+    "CPU_RUNTIME_CACHE_BYTE_BUDGET"};
+
+/**
+ * @brief Defines the directory used to share the repacked weights between the processes running on the same host, e.g.
+ * a tmpfs mount like /dev/shm. The repacked weights are placed into files mapped to all the processes using the same
+ * weights on the same NUMA node, and the files are removed when the last process releases them (see
+ * shared_weights_persistent).
+ * An empty value (default) keeps the repacked weights private to the process. Not supported on Windows.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> shared_weights_dir{"CPU_SHARED_WEIGHTS_DIR"};
+
+/**
+ * @brief Keeps the files of the repacked weights in the shared_weights_dir after the last process releases them, so the
+ * directory serves as a persistent cache of the repacked weights. The files are keyed by the weights content and the
+ * target layout, so they are reused after a restart, a change of the compile configuration or an edit of other layers
+ * of the model. The least recently used files not mapped by any process are removed when the directory exceeds
+ * shared_weights_max_size. The default value is false.
+ */
+static constexpr Property<bool, PropertyMutability::RW> shared_weights_persistent{"CPU_SHARED_WEIGHTS_PERSISTENT"};
+
+/**
+ * @brief Defines the maximal size in bytes of the files kept in the shared_weights_dir in the persistent mode. A file
+ * which does not fit is not created and the repacked weights stay private to the process. The default value 0 limits
+ * the size to 4 GiB.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> shared_weights_max_size{"CPU_SHARED_WEIGHTS_MAX_SIZE"};
+
+/**
+ * @brief Defines the minimal ratio of the new size to the previous one when the intermediate memory of a dynamic shape
+ * graph is reallocated, so the gradually growing shapes cause a logarithmic number of reallocations. The default value
+ * 1.0 means the memory is reallocated to exactly the requested size.
+ */
+static constexpr Property<float, PropertyMutability::RW> dynamic_memory_growth_factor{
+    "CPU_DYNAMIC_MEMORY_GROWTH_FACTOR"};
+
+/**
+ * @brief Defines whether the intermediate memory of the bounded dynamic shapes (e.g. the model is reshaped to
+ * {1, {1, 2048}}) is allocated for the upper bound of the shape range in advance, so the inference does not reallocate
+ * it.
+ */
+static constexpr Property<bool, PropertyMutability::RW> dynamic_memory_reserve{"CPU_DYNAMIC_MEMORY_RESERVE"};
+
+/**
+ * @brief Defines whether the big intermediate memory arenas are advised to be backed by transparent huge pages.
+ * Only takes effect on Linux.
+ */
+static constexpr Property<bool, PropertyMutability::RW> memory_huge_pages{"CPU_MEMORY_HUGE_PAGES"};
+
+/**
+ * @brief Defines whether the independent nodes of a static graph may be executed concurrently.
+ * Only the nodes too small to occupy all the threads of the stream with the intra-op parallelism are considered.
+ * Only takes effect with TBB threading.
+ * The nodes of the runtime model executed concurrently have the same "execWave" runtime info.
+ */
+static constexpr Property<bool, PropertyMutability::RW> inter_op_parallelism{"CPU_INTER_OP_PARALLELISM"};
+
+/**
+ * @brief Defines whether each stream of a compiled model takes the inference requests from its own lock-free queue and
+ * steals the requests queued to the busy streams of the same NUMA node, instead of a single queue shared by all the
+ * streams. The default value is false.
+ */
+static constexpr Property<bool, PropertyMutability::RW> streams_work_stealing{"CPU_STREAMS_WORK_STEALING"};
+
+/**
+ * @brief Defines the number of the graph input shape combinations, for which the output shapes of the dynamic nodes
+ * are memoized, so the shape inference is skipped when a combination repeats. Zero disables the memoization.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> shape_inference_cache_capacity{
+    "CPU_SHAPE_INFERENCE_CACHE_CAPACITY"};
+
+/**
+ * @brief Read-only property to get the lookup statistics of the CPU runtime parameters caches of a compiled model.
+ * The map contains the number of "hits", "misses", "evictions", stored "entries" and their estimated "bytes" summed
+ * over all the caches, as well as the same counters per cache entry in the "<key type> -> <value type>.<counter>"
+ * form. The counters of the shape inference cache of the dynamic graphs (see shape_inference_cache_capacity) are
+ * reported separately in the "ShapeInferenceCache.<counter>" form.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the intermediate memory footprint of a compiled model. For each memory control unit
+ * of each stream graph the map contains the size of the arena shared by the static intermediate tensors and the lower
+ * bound of this size (the peak total size of the tensors alive at the same time) as "<stream>.<unit>.arena_bytes" and
+ * "<stream>.<unit>.lower_bound_bytes", as well as the number of the reallocations of the already allocated dynamic
+ * memory blocks happened during the inference as "<stream>.<unit>.reallocations", which are also reported by the
+ * profiling info as a "MemoryReallocations" row per memory control unit. The "arena_bytes", "lower_bound_bytes",
+ * "fragmentation_bytes" and "reallocations" entries are the sums over all the graphs initialized so far. The
+ * "offloaded_states" and "offloaded_state_bytes" entries report the variable states currently paged out to files by
+ * ov::VariableState::offload() and their size on disk. Reading the property waits for the inference running on each
+ * graph to finish.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> intermediate_memory_statistics{
+    "CPU_INTERMEDIATE_MEMORY_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
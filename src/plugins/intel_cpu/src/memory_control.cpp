@@ -5,9 +5,11 @@
 #include "memory_control.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <queue>
@@ -21,13 +23,30 @@
 #include "cpu_memory.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
+#include "utils/best_fit_memory_solver.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
 namespace ov::intel_cpu {
 
 namespace {
 
+void adviseHugePages([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    constexpr uintptr_t hugePageSize = 2 * 1024 * 1024;
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + hugePageSize - 1) & ~(hugePageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(hugePageSize - 1);
+    // only the whole huge pages inside the block can be backed, the advice is just a hint so the result is ignored
+    if (end > begin) {
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
 class StaticPartitionMemoryBlock : public IMemoryBlockObserver {
 public:
     StaticPartitionMemoryBlock(MemoryBlockPtr pBlock, ptrdiff_t offset)
@@ -63,7 +82,17 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
+    using Counter = std::shared_ptr<std::atomic_size_t>;
+
+    /**
+     * @param growthFactor is the minimal ratio of the new size to the current one when the block is reallocated
+     * @param hugePages defines whether the allocated memory is advised to be backed by huge pages
+     * @param reallocations is an optional counter of the reallocations of the already allocated block on resize
+     */
+    explicit MemoryBlockWithRelease(float growthFactor = 1.0F, bool hugePages = false, Counter reallocations = nullptr)
+        : m_growthFactor(growthFactor),
+          m_hugePages(hugePages),
+          m_reallocations(std::move(reallocations)) {
         auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
@@ -76,7 +105,22 @@ public:
         m_pBlock->setExtBuff(ptr, size);
     }
     bool resize(size_t size) override {
-        return m_pBlock->resize(size);
+        const size_t currentSize = m_pInternalMem->size();
+        if (size > currentSize && currentSize > 0 && m_growthFactor > 1.0F) {
+            size = std::max(size, static_cast<size_t>(static_cast<double>(currentSize) * m_growthFactor));
+        }
+        const bool sizeChanged = allocate(size);
+        // the first allocation of an empty block is not a reallocation
+        if (sizeChanged && currentSize > 0 && m_reallocations) {
+            m_reallocations->fetch_add(1, std::memory_order_relaxed);
+        }
+        return sizeChanged;
+    }
+    /**
+     * @brief Allocates the memory in advance, so the following resize calls up to this size do not reallocate
+     */
+    void reserve(size_t size) {
+        allocate(size);
     }
     [[nodiscard]] bool hasExtBuffer() const noexcept override {
         return m_pBlock->hasExtBuffer();
@@ -96,8 +140,19 @@ public:
     }
 
 private:
+    bool allocate(size_t size) {
+        const bool sizeChanged = m_pBlock->resize(size);
+        if (sizeChanged && m_hugePages) {
+            adviseHugePages(m_pBlock->getRawPtr(), size);
+        }
+        return sizeChanged;
+    }
+
     MemoryBlockPtr m_pBlock;
     MemoryBlockWithReuse* m_pInternalMem;
+    float m_growthFactor;
+    bool m_hugePages;
+    Counter m_reallocations;
 };
 
 #ifdef CPU_DEBUG_CAPS
@@ -154,6 +209,9 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    [[nodiscard]] virtual MemoryArenaStatistics arenaStatistics() const {
+        return {};
+    }
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -201,6 +259,8 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(bool hugePages = false) : m_hugePages(hugePages) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -224,17 +284,32 @@ private:
         });
 
         ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
-
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        const int64_t firstFitSize = staticMemSolver.solve();
+        BestFitMemorySolver bestFitMemSolver(boxes_to_process);
+        // the best-fit placement is quadratic in the number of boxes, so it is skipped for the large graphs to keep
+        // the compilation time bounded
+        constexpr size_t bestFitMaxBoxes = 4096;
+        const int64_t bestFitSize = boxes_to_process.size() <= bestFitMaxBoxes ? bestFitMemSolver.solve()
+                                                                               : std::numeric_limits<int64_t>::max();
+        // none of the heuristics gives the smallest arena for all the graphs, so the best solution is taken
+        const bool useBestFit = bestFitSize < firstFitSize;
+        m_totalSize = static_cast<size_t>(std::min(firstFitSize, bestFitSize)) * alignment;
+        m_lowerBound = static_cast<size_t>(bestFitMemSolver.getLowerBound()) * alignment;
+
+        m_workspace = std::make_shared<MemoryBlockWithRelease>(1.0F, m_hugePages);
 
         for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
+            int64_t offset = useBestFit ? bestFitMemSolver.getOffset(box.id)
+                                        : staticMemSolver.get_offset(static_cast<int>(box.id));
             auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
     }
 
+    [[nodiscard]] MemoryArenaStatistics arenaStatistics() const override {
+        return {m_totalSize, m_lowerBound};
+    }
+
     void allocate() override {
         if (m_workspace) {
             m_workspace->resize(m_totalSize);
@@ -254,14 +329,21 @@ private:
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
     size_t m_totalSize = 0;
+    size_t m_lowerBound = 0;
+    bool m_hugePages = false;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    explicit MemoryManagerNonOverlappingSets(const DynamicMemoryPolicy& policy = {})
+        : m_policy(policy),
+          m_reallocations(std::make_shared<std::atomic_size_t>(0)) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
+        m_maxSizes[reg.id] = reg.max_size;
         if (-1 != reg.finish) {
             // We have to extend the lifespan of tensors that are crossing a sync point border in order to save
             // the intermediate computation results from possible loss due to the tensor resize
@@ -305,6 +387,7 @@ private:
 
     void solve() {
         ov::MemorySolver::normalize_boxes(m_boxes);
+        m_reservations.clear();
 
         std::vector<std::vector<ov::MemorySolver::Box>> groups;  // groups of non overlapping boxes
         groups.push_back({m_boxes.front()});
@@ -325,15 +408,24 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block =
+                std::make_shared<MemoryBlockWithRelease>(m_policy.growth_factor, m_policy.huge_pages, m_reallocations);
+            size_t reservation = 0;
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
+                reservation = std::max(reservation, static_cast<size_t>(std::max<int64_t>(m_maxSizes.at(box.id), 0)));
+            }
+            if (m_policy.reserve_upper_bound && reservation > 0) {
+                m_reservations.emplace_back(unique_block, reservation);
             }
         }
     }
 
     void allocate() override {
-        // nothing to do
+        // the unbounded regions of the group are still allocated on demand
+        for (auto&& [block, size] : m_reservations) {
+            block->reserve(size);
+        }
     }
     void release() override {
         for (auto&& item : m_internalBlocks) {
@@ -341,6 +433,12 @@ private:
         }
     }
 
+    [[nodiscard]] MemoryArenaStatistics arenaStatistics() const override {
+        MemoryArenaStatistics retVal;
+        retVal.reallocations = m_reallocations->load(std::memory_order_relaxed);
+        return retVal;
+    }
+
     static const char* getClassName() {
         return "MemoryManagerNonOverlappingSets";
     }
@@ -348,6 +446,10 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    std::unordered_map<MemoryControl::MemorySolution::key_type, int64_t> m_maxSizes;
+    std::vector<std::pair<std::shared_ptr<MemoryBlockWithRelease>, size_t>> m_reservations;
+    DynamicMemoryPolicy m_policy;
+    MemoryBlockWithRelease::Counter m_reallocations;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -479,6 +581,10 @@ public:
         m_memManager->release();
     }
 
+    [[nodiscard]] MemoryArenaStatistics arenaStatistics() const {
+        return m_memManager->arenaStatistics();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -517,18 +623,22 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, const DynamicMemoryPolicy& policy) : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        policy.huge_pages));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        policy));
 
     // handler for I/O tensors, so far simply individual blocks
     m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
@@ -579,6 +689,17 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+MemoryArenaStatistics MemoryControl::getArenaStatistics() const {
+    MemoryArenaStatistics retVal;
+    for (auto&& handler : m_handlers) {
+        auto stats = handler->arenaStatistics();
+        retVal.arena_size += stats.arena_size;
+        retVal.lower_bound += stats.lower_bound;
+        retVal.reallocations += stats.reallocations;
+    }
+    return retVal;
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -590,7 +711,7 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_policy)));
     return m_controlUnits.back();
 }
 
@@ -606,6 +727,15 @@ void NetworkMemoryControl::releaseMemory() {
     }
 }
 
+std::vector<std::pair<std::string, MemoryArenaStatistics>> NetworkMemoryControl::getArenaStatistics() const {
+    std::vector<std::pair<std::string, MemoryArenaStatistics>> retVal;
+    retVal.reserve(m_controlUnits.size());
+    for (auto&& item : m_controlUnits) {
+        retVal.emplace_back(item->getId(), item->getArenaStatistics());
+    }
+    return retVal;
+}
+
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
 #ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<std::string, MemoryStatistics>> retVal;
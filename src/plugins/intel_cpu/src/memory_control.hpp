@@ -28,6 +28,20 @@ struct MemoryRegion {
 
     enum class RegionType : uint8_t { VARIABLE, CONSTANT, INPUT, OUTPUT, IO } type;
     enum class AllocType : uint8_t { POD, STRING, UNKNOWN } alloc_type;
+    int64_t max_size = -1;  // upper bound of the size in bytes of a dynamic region, -1 means unbounded
+};
+
+/**
+ * @brief Defines how the memory of the dynamic regions is allocated
+ */
+struct DynamicMemoryPolicy {
+    // a block is reallocated to at least growth_factor times of its previous size, so a gradually growing shape
+    // causes a logarithmic number of reallocations
+    float growth_factor = 1.0F;
+    // the blocks of the regions with bounded dynamic shapes are allocated for the upper bound in advance
+    bool reserve_upper_bound = false;
+    // the big arenas are advised to be backed by transparent huge pages
+    bool huge_pages = false;
 };
 
 using MemoryRegions = std::vector<MemoryRegion>;
@@ -38,10 +52,23 @@ struct MemoryStatisticsRecord {
     size_t total_size;           // bytes
     size_t optimal_total_size;   // bytes
     size_t max_region_size;      // bytes
+
+    // share of the total size which is not used by the optimal placement, percents
+    [[nodiscard]] double fragmentation() const {
+        return total_size > optimal_total_size ? 100.0 * static_cast<double>(total_size - optimal_total_size) /
+                                                     static_cast<double>(total_size)
+                                               : 0.0;
+    }
 };
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
 
+struct MemoryArenaStatistics {
+    size_t arena_size = 0;     // bytes
+    size_t lower_bound = 0;    // bytes, max total size of the regions alive at the same time
+    size_t reallocations = 0;  // number of the reallocations of the non-empty dynamic blocks
+};
+
 class MemoryControl {
 public:
     class RegionHandler;
@@ -66,8 +93,13 @@ public:
         return m_id;
     }
 
+    /**
+     * @brief Returns the size of the memory arenas shared by the static regions and the lower bound of this size
+     */
+    [[nodiscard]] MemoryArenaStatistics getArenaStatistics() const;
+
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, const DynamicMemoryPolicy& policy);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -81,12 +113,14 @@ private:
 class NetworkMemoryControl {
 public:
     NetworkMemoryControl() = default;
+    explicit NetworkMemoryControl(const DynamicMemoryPolicy& policy) : m_policy(policy) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
     void releaseMemory();
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
+    [[nodiscard]] std::vector<std::pair<std::string, MemoryArenaStatistics>> getArenaStatistics() const;
 
     [[nodiscard]] const std::vector<MemoryControl::Ptr>& controlUnits() const {
         return m_controlUnits;
@@ -94,6 +128,7 @@ public:
 
 private:
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    DynamicMemoryPolicy m_policy;
 };
 
 }  // namespace ov::intel_cpu
@@ -9,7 +9,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <utility>
@@ -28,7 +32,9 @@
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "utils/general_utils.h"
 #include "utils/plain_tensor.hpp"
 
@@ -226,23 +232,34 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
                                            const bool quant_by_channel,
-                                           const size_t group_size)
+                                           const size_t group_size,
+                                           OffloadedStatesStatisticsPtr offload_statistics)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
-      m_group_size(group_size) {
+      m_group_size(group_size),
+      m_offload_statistics(std::move(offload_statistics)) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
+VariableStateKVcache::~VariableStateKVcache() {
+    // the state may be released while offloaded, e.g. with its infer request, so the file is removed here
+    discard_offloaded();
+}
+
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
-    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+    // the offloaded state is read from the file without paging it in
+    const auto content = is_offloaded() ? load_offloaded() : Content{m_internal_mem, m_hidden_state, m_scale_zp};
+    const auto& internal_mem = content.internal_mem;
+    const auto& scale_zp = content.scale_zp;
+    if (!internal_mem || !content.hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
         return std::make_shared<Tensor>(external_mem);
     }
 
-    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto actual_internal_desc = internal_mem->getDescWithType<BlockedMemoryDesc>();
     auto&& dims = actual_internal_desc->getShape().getStaticDims();
 
     auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
@@ -260,8 +277,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     PlainTensor pastkv;
     PlainTensor beam_table;
     output.reset(external_mem);
-    beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
+    beam_table.reset(content.hidden_state);
+    pastkv.reset(internal_mem);
     output = output.permute(actual_internal_order);
     pastkv = pastkv.permute(actual_internal_order);
     // S should be always the last dimension
@@ -270,7 +287,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     auto B = pastkv.size(1);
     auto H = pastkv.size(2);
     auto S = pastkv.size(3);
-    if (pastkv.get_precision() == element::u8) {
+    if (any_of(pastkv.get_precision(), element::u8, element::u4)) {
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
         if (m_quant_by_channel) {
@@ -284,8 +301,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                                            S,
                                            pastkv.m_strides[2],
                                            S,
-                                           m_scale_zp.ptr<float>(group_id * 2, b_kv, h),
-                                           m_scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                                           scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                           scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         } else {
@@ -293,10 +310,16 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                 auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
                 buffers[ithr].resize<float>({S});
                 for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
-                                    buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                    m_group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                    auto* dst = buffers[ithr].ptr<float>() + group_id * m_group_size;
+                    auto* params = scale_zp.ptr<float>(m, b_kv, h, group_id * 2);
+                    if (pastkv.get_precision() == element::u4) {
+                        attn_dequant_u4(pastkv.ptr_v(m, b_kv, h, group_id * m_group_size), dst, m_group_size, params);
+                    } else {
+                        attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
+                                        dst,
+                                        m_group_size,
+                                        params);
+                    }
                 }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
@@ -311,7 +334,233 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     return std::make_shared<Tensor>(external_mem);
 }
 
+void VariableStateKVcache::trim(size_t length) {
+    restore();
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        OPENVINO_ASSERT(length == 0, "Cannot trim the empty state ", get_name(), " to the length ", length);
+        return;
+    }
+
+    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto&& order = m_dense_internal_desc->getOrder();
+    // the sequence axis is the outermost one in the internal layout
+    const auto axis = order.at(0);
+    auto dims = actual_internal_desc->getShape().getStaticDims();
+    OPENVINO_ASSERT(length <= dims.at(axis),
+                    "Cannot trim the state ",
+                    get_name(),
+                    " of the length ",
+                    dims.at(axis),
+                    " to the greater length ",
+                    length);
+    if (length == dims.at(axis)) {
+        return;
+    }
+    if (length == 0) {
+        reset();
+        return;
+    }
+
+    // the buffers keep their strides, so the tokens beyond the new length are simply overwritten by the next inference
+    // the scales and zero points of the cache quantized by token remain valid as well. The keys quantized by channel
+    // share them within the group of tokens: the kept tokens of the trimmed group are still dequantized by them, and
+    // the next inference requantizes the group together with the appended tokens
+    dims[axis] = length;
+    auto block_dims = actual_internal_desc->getBlockDims();
+    block_dims[0] = length;
+    m_internal_mem->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(actual_internal_desc->getPrecision(),
+                                                                        Shape(dims),
+                                                                        block_dims,
+                                                                        actual_internal_desc->getOrder(),
+                                                                        0,
+                                                                        VectorDims{},
+                                                                        actual_internal_desc->getStrides()));
+
+    auto beam_table_desc = m_hidden_state->getDescWithType<BlockedMemoryDesc>();
+    VectorDims beam_table_dims{beam_table_desc->getShape().getStaticDims().at(0), length};
+    m_hidden_state->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                        Shape(beam_table_dims),
+                                                                        beam_table_dims,
+                                                                        VectorDims{0, 1},
+                                                                        0,
+                                                                        VectorDims{},
+                                                                        beam_table_desc->getStrides()));
+}
+
+namespace {
+
+// the header of the file keeping the content of an offloaded KV cache state
+struct OffloadedKVcacheHeader {
+    static constexpr uint64_t signature = 0x3145484341435f4bULL;  // "K_CACHE1"
+    uint64_t magic = signature;
+    uint64_t precision = 0;          // ov::element::Type_t of the cache
+    uint64_t dims[4] = {};           // logical dims of the cache
+    uint64_t block_dims[4] = {};     // dims of the cache in the internal order
+    uint64_t strides[4] = {};        // strides of the cache in the internal order
+    uint64_t scale_zp_dims[4] = {};  // all zeros for the not quantized cache
+    uint64_t beam_table_dims[2] = {};
+};
+
+// the sequence is the outermost dimension of the internal layout, so the stored tokens occupy a contiguous range
+size_t cache_bytes(const OffloadedKVcacheHeader& header) {
+    const ov::element::Type precision(static_cast<ov::element::Type_t>(header.precision));
+    return div_up(header.block_dims[0] * header.strides[0] * precision.bitwidth(), 8);
+}
+
+}  // namespace
+
+void VariableStateKVcache::offload(const std::string& file_path) {
+    OPENVINO_ASSERT(!is_offloaded(), "The state ", get_name(), " is already offloaded to ", m_offload_path);
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        // nothing to page out
+        return;
+    }
+
+    OffloadedKVcacheHeader header;
+    auto internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    const auto& dims = internal_desc->getShape().getStaticDims();
+    const auto& block_dims = internal_desc->getBlockDims();
+    const auto& strides = internal_desc->getStrides();
+    OPENVINO_ASSERT(all_of(4U, dims.size(), block_dims.size(), strides.size()),
+                    "Unexpected rank of the state ",
+                    get_name());
+    header.precision = static_cast<uint64_t>(ov::element::Type_t(internal_desc->getPrecision()));
+    std::copy(dims.begin(), dims.end(), header.dims);
+    std::copy(block_dims.begin(), block_dims.end(), header.block_dims);
+    std::copy(strides.begin(), strides.end(), header.strides);
+
+    PlainTensor beam_table;
+    beam_table.reset(m_hidden_state);
+    const auto B = beam_table.size(0);
+    const auto L = beam_table.size(1);
+    header.beam_table_dims[0] = B;
+    header.beam_table_dims[1] = L;
+
+    if (m_scale_zp) {
+        OPENVINO_ASSERT(m_scale_zp.is_dense(), "Unexpected layout of the scales and zero points of ", get_name());
+        // the scales and zero points are stored per token or per group of tokens in the outermost dimension
+        header.scale_zp_dims[0] = m_quant_by_channel ? div_up(L, m_group_size) * 2 : L;
+        std::copy(m_scale_zp.m_dims + 1, m_scale_zp.m_dims + 4, header.scale_zp_dims + 1);
+    }
+
+    // the file is created exclusively, so an existing file is never overwritten or removed by discard_offloaded()
+    std::unique_ptr<std::FILE, decltype(&std::fclose)> file(std::fopen(file_path.c_str(), "wbx"), &std::fclose);
+    OPENVINO_ASSERT(file,
+                    "Cannot create the file ",
+                    file_path,
+                    " to offload the state ",
+                    get_name(),
+                    ", the file must not exist");
+    size_t written = 0;
+    auto write = [&](const void* data, size_t bytes) {
+        if (std::fwrite(data, 1, bytes, file.get()) != bytes) {
+            file.reset();
+            std::remove(file_path.c_str());
+            OPENVINO_THROW("Cannot write the file ", file_path, " to offload the state ", get_name());
+        }
+        written += bytes;
+    };
+    write(&header, sizeof(header));
+    write(m_internal_mem->getData(), cache_bytes(header));
+    if (m_scale_zp) {
+        write(m_scale_zp.ptr<float>(), header.scale_zp_dims[0] * m_scale_zp.stride(0) * sizeof(float));
+    }
+    for (size_t b = 0; b < B; b++) {
+        write(beam_table.ptr<int32_t>(b), L * sizeof(int32_t));
+    }
+    if (std::fclose(file.release()) != 0) {
+        std::remove(file_path.c_str());
+        OPENVINO_THROW("Cannot write the file ", file_path, " to offload the state ", get_name());
+    }
+
+    m_offloaded_bytes = written;
+    m_offload_path = file_path;
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = {};
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    if (m_offload_statistics) {
+        m_offload_statistics->states++;
+        m_offload_statistics->bytes += m_offloaded_bytes;
+    }
+}
+
+void VariableStateKVcache::restore() {
+    if (!is_offloaded()) {
+        return;
+    }
+
+    auto content = load_offloaded();
+    m_internal_mem = content.internal_mem;
+    m_hidden_state = content.hidden_state;
+    m_scale_zp = content.scale_zp;
+    // the buffers are sized to the stored tokens exactly, the next inference reallocates them with a headroom
+    m_internal_mem_max_size = m_internal_mem->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+    m_hidden_state_max_size = m_hidden_state->getShape().getElementsCount();
+    discard_offloaded();
+}
+
+VariableStateKVcache::Content VariableStateKVcache::load_offloaded() const {
+    auto mapped = ov::load_mmap_object(m_offload_path);
+    OPENVINO_ASSERT(mapped && mapped->size() == m_offloaded_bytes,
+                    "The file ",
+                    m_offload_path,
+                    " of the offloaded state ",
+                    get_name(),
+                    " is missing or modified");
+    const char* data = mapped->data();
+    OffloadedKVcacheHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    OPENVINO_ASSERT(header.magic == OffloadedKVcacheHeader::signature,
+                    "The file ",
+                    m_offload_path,
+                    " doesn't keep an offloaded KV cache state");
+    data += sizeof(header);
+
+    Content content;
+    const ov::element::Type precision(static_cast<ov::element::Type_t>(header.precision));
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(precision,
+                                                       Shape(VectorDims(header.dims, header.dims + 4)),
+                                                       VectorDims(header.block_dims, header.block_dims + 4),
+                                                       m_dense_internal_desc->getOrder(),
+                                                       0,
+                                                       VectorDims{},
+                                                       VectorDims(header.strides, header.strides + 4));
+    content.internal_mem = std::make_shared<Memory>(get_engine(), desc);
+    std::memcpy(content.internal_mem->getData(), data, cache_bytes(header));
+    data += cache_bytes(header);
+
+    if (header.scale_zp_dims[0] > 0) {
+        content.scale_zp.resize<float>(VectorDims(header.scale_zp_dims, header.scale_zp_dims + 4));
+        const auto bytes = header.scale_zp_dims[0] * content.scale_zp.stride(0) * sizeof(float);
+        std::memcpy(content.scale_zp.ptr<float>(), data, bytes);
+        data += bytes;
+    }
+
+    const auto B = header.beam_table_dims[0];
+    const auto L = header.beam_table_dims[1];
+    auto beam_table_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{B, L});
+    content.hidden_state = std::make_shared<Memory>(get_engine(), beam_table_desc);
+    std::memcpy(content.hidden_state->getData(), data, B * L * sizeof(int32_t));
+    return content;
+}
+
+void VariableStateKVcache::discard_offloaded() {
+    if (!is_offloaded()) {
+        return;
+    }
+    std::remove(m_offload_path.c_str());
+    if (m_offload_statistics) {
+        m_offload_statistics->states--;
+        m_offload_statistics->bytes -= m_offloaded_bytes;
+    }
+    m_offload_path.clear();
+    m_offloaded_bytes = 0;
+}
+
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    discard_offloaded();
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -322,7 +571,7 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
     Memory external_mem(get_engine(), state_desc, m_state->data());
 
-    if (dense_internal_desc->getPrecision() == element::u8) {
+    if (any_of(dense_internal_desc->getPrecision(), element::u8, element::u4)) {
         PlainTensor external;
         PlainTensor internal;
         auto&& actual_internal_order = m_dense_internal_desc->getOrder();
@@ -365,11 +614,18 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                 buffers[ithr].resize<float>({S});
                 cpu_convert(external.ptr_v(m, b, h), buffers[ithr].ptr<float>(), external.m_dt, element::f32, S);
                 for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_quant_u8(buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                  internal.ptr<uint8_t>(m, b, h, group_id * m_group_size),
-                                  m_group_size,
-                                  m_scale_zp.at<float>({m, b, h, group_id * 2}),
-                                  m_scale_zp.at<float>({m, b, h, group_id * 2 + 1}));
+                    auto* src = buffers[ithr].ptr<float>() + group_id * m_group_size;
+                    auto& scale = m_scale_zp.at<float>({m, b, h, group_id * 2});
+                    auto& zp = m_scale_zp.at<float>({m, b, h, group_id * 2 + 1});
+                    if (internal.get_precision() == element::u4) {
+                        attn_quant_u4(src, internal.ptr_v(m, b, h, group_id * m_group_size), m_group_size, scale, zp);
+                    } else {
+                        attn_quant_u8(src,
+                                      internal.ptr<uint8_t>(m, b, h, group_id * m_group_size),
+                                      m_group_size,
+                                      scale,
+                                      zp);
+                    }
                 }
             });
         }
@@ -397,7 +653,7 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    discard_offloaded();
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -431,4 +687,133 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+namespace {
+// copies the heads [begin, begin + heads of the part) between the dense tensors holding all the heads and the part of
+// them along the axis
+void copyHeads(const ov::SoPtr<ov::ITensor>& full,
+               const ov::SoPtr<ov::ITensor>& part,
+               size_t axis,
+               size_t begin,
+               bool toFull) {
+    const auto& fullShape = full->get_shape();
+    const auto& partShape = part->get_shape();
+    const auto precision = full->get_element_type();
+    OPENVINO_ASSERT(precision == part->get_element_type() && precision.bitwidth() % 8 == 0,
+                    "Unexpected precision of the tensor parallel state: ",
+                    precision);
+    OPENVINO_ASSERT(full->is_continuous() && part->is_continuous(), "The tensor parallel state must be dense");
+    const size_t outer =
+        std::accumulate(partShape.begin(), partShape.begin() + axis, static_cast<size_t>(1), std::multiplies<>());
+    const size_t inner =
+        std::accumulate(partShape.begin() + axis + 1, partShape.end(), precision.size(), std::multiplies<>());
+    const size_t partStride = partShape[axis] * inner;
+    const size_t fullStride = fullShape[axis] * inner;
+    auto* fullData = static_cast<uint8_t*>(full->data());
+    auto* partData = static_cast<uint8_t*>(part->data());
+    parallel_for(outer, [&](size_t i) {
+        auto* fullPtr = fullData + i * fullStride + begin * inner;
+        auto* partPtr = partData + i * partStride;
+        if (toFull) {
+            std::memcpy(fullPtr, partPtr, partStride);
+        } else {
+            std::memcpy(partPtr, fullPtr, partStride);
+        }
+    });
+}
+}  // namespace
+
+VariableStateTensorParallel::VariableStateTensorParallel(std::vector<ov::SoPtr<ov::IVariableState>> states)
+    : ov::IVariableState(states.at(0)->get_name()),
+      m_states(std::move(states)) {}
+
+std::optional<VariableStateKVcache::HeadRange> VariableStateTensorParallel::head_range(size_t idx) const {
+    const auto kvState = std::dynamic_pointer_cast<VariableStateKVcache>(m_states[idx]._ptr);
+    if (!kvState) {
+        return std::nullopt;
+    }
+    return kvState->head_range();
+}
+
+void VariableStateTensorParallel::reset() {
+    for (const auto& state : m_states) {
+        state->reset();
+    }
+}
+
+void VariableStateTensorParallel::set_state(const ov::SoPtr<ov::ITensor>& state) {
+    if (!head_range(0)) {
+        for (const auto& subState : m_states) {
+            subState->set_state(state);
+        }
+        return;
+    }
+
+    const auto axis = std::dynamic_pointer_cast<VariableStateKVcache>(m_states[0]._ptr)->head_axis();
+    const auto& shape = state->get_shape();
+    const auto total = head_range(0)->total;
+    OPENVINO_ASSERT(shape.size() > axis && shape[axis] == total,
+                    "The state ",
+                    get_name(),
+                    " of the tensor parallel model holds all the ",
+                    total,
+                    " heads on the axis ",
+                    axis,
+                    ", but the tensor of the shape ",
+                    shape,
+                    " is set");
+    for (size_t i = 0; i < m_states.size(); i++) {
+        const auto range = head_range(i);
+        OPENVINO_ASSERT(range && range->total == total, "The state ", get_name(), " is split inconsistently");
+        auto partShape = shape;
+        partShape[axis] = range->end - range->begin;
+        ov::SoPtr<ov::ITensor> part = ov::make_tensor(state->get_element_type(), partShape);
+        copyHeads(state, part, axis, range->begin, false);
+        m_states[i]->set_state(part);
+    }
+}
+
+ov::SoPtr<ov::ITensor> VariableStateTensorParallel::get_state() const {
+    auto first = m_states[0]->get_state();
+    // the reset state is empty, so there are no heads to gather
+    if (!head_range(0) || first->get_size() == 0) {
+        return first;
+    }
+
+    const auto axis = std::dynamic_pointer_cast<VariableStateKVcache>(m_states[0]._ptr)->head_axis();
+    auto shape = first->get_shape();
+    shape[axis] = head_range(0)->total;
+    ov::SoPtr<ov::ITensor> full = ov::make_tensor(first->get_element_type(), shape);
+    for (size_t i = 0; i < m_states.size(); i++) {
+        const auto range = head_range(i);
+        auto part = i == 0 ? first : m_states[i]->get_state();
+        OPENVINO_ASSERT(range && part->get_shape().size() == shape.size() &&
+                            part->get_shape()[axis] == range->end - range->begin,
+                        "The state ",
+                        get_name(),
+                        " is split inconsistently");
+        copyHeads(full, part, axis, range->begin, true);
+    }
+    return full;
+}
+
+void VariableStateTensorParallel::trim(size_t length) {
+    for (const auto& state : m_states) {
+        state->trim(length);
+    }
+}
+
+void VariableStateTensorParallel::offload(const std::string& file_path) {
+    // every sub-stream pages out its part of the state to its own file
+    for (size_t i = 0; i < m_states.size(); i++) {
+        m_states[i]->offload(file_path + "." + std::to_string(i));
+    }
+}
+
+void VariableStateTensorParallel::restore() {
+    for (const auto& state : m_states) {
+        state->restore();
+    }
+}
+
 }  // namespace ov::intel_cpu
@@ -5,10 +5,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "memory_desc/blocked_memory_desc.h"
@@ -118,16 +121,29 @@ private:
     MemoryDescPtr m_internal_desc;  // mem desc required by the graph internal tensor
 };
 
+// the footprint of the variable states paged out to the files, shared by the states of a graph
+struct OffloadedStatesStatistics {
+    std::atomic<size_t> states{0};
+    std::atomic<size_t> bytes{0};
+};
+
+using OffloadedStatesStatisticsPtr = std::shared_ptr<OffloadedStatesStatistics>;
+
 class VariableStateKVcache : public VariableStateBase {
 public:
     VariableStateKVcache(const std::string& name,
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          bool quant_by_channel,
-                         size_t group_size = 0);
+                         size_t group_size = 0,
+                         OffloadedStatesStatisticsPtr offload_statistics = nullptr);
+    ~VariableStateKVcache() override;
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
+    void trim(size_t length) override;
+    void offload(const std::string& file_path) override;
+    void restore() override;
 
     // ov::intel_cpu::VariableStateBase
     MemoryPtr input_mem() override;
@@ -162,12 +178,43 @@ public:
         m_scale_zp = t;
     }
 
+    bool is_offloaded() const {
+        return !m_offload_path.empty();
+    }
+
+    // the key/value heads [begin, end) out of the total number of the heads held by the state of a tensor parallel
+    // sub-stream
+    struct HeadRange {
+        size_t begin;
+        size_t end;
+        size_t total;
+    };
+    void assign_head_range(const HeadRange& range) {
+        m_head_range = range;
+    }
+    const std::optional<HeadRange>& head_range() const {
+        return m_head_range;
+    }
+    // the axis of the heads in the external layout of the state
+    size_t head_axis() const {
+        return m_dense_internal_desc->getOrder()[2];
+    }
+
 private:
+    struct Content {
+        MemoryPtr internal_mem;
+        MemoryPtr hidden_state;
+        PlainTensor scale_zp;
+    };
+
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    Content load_offloaded() const;
+    void discard_offloaded();
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -180,6 +227,35 @@ private:
     PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+
+    // the file keeping the content of the offloaded state, empty if the state is resident
+    std::string m_offload_path;
+    size_t m_offloaded_bytes = 0;
+    OffloadedStatesStatisticsPtr m_offload_statistics;
+
+    std::optional<HeadRange> m_head_range;
+};
+
+/**
+ * @brief The state of a tensor parallel model, which combines the states of the same variable in all the sub-streams.
+ * The key/value cache states split by heads between the sub-streams are gathered by get_state() and scattered by
+ * set_state(), so the public state keeps the full shape. The other states are replicated in every sub-stream.
+ */
+class VariableStateTensorParallel : public ov::IVariableState {
+public:
+    explicit VariableStateTensorParallel(std::vector<ov::SoPtr<ov::IVariableState>> states);
+
+    void reset() override;
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override;
+    ov::SoPtr<ov::ITensor> get_state() const override;
+    void trim(size_t length) override;
+    void offload(const std::string& file_path) override;
+    void restore() override;
+
+private:
+    std::optional<VariableStateKVcache::HeadRange> head_range(size_t idx) const;
+
+    std::vector<ov::SoPtr<ov::IVariableState>> m_states;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
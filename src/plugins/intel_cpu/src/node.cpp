@@ -752,7 +752,7 @@ static void fetchRawMemory(const MemoryPtr& mem) {
     }
 }
 
-void Node::updateShapes() {
+void Node::updateShapes(std::vector<VectorDims>* outputShapesMemo) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
                     getTypeStr(),
@@ -760,9 +760,16 @@ void Node::updateShapes() {
                     getName());
     try {
         if (needShapeInfer()) {
+            if (outputShapesMemo && !outputShapesMemo->empty()) {
+                redefineOutputMemory(*outputShapesMemo);
+                return;
+            }
             auto result = shapeInfer();
             if (ShapeInferStatus::success == result.status) {
                 redefineOutputMemory(result.dims);
+                if (outputShapesMemo) {
+                    *outputShapesMemo = std::move(result.dims);
+                }
             }
         } else {
             // guard check for internal dynamic nodes to avoid possible overestimation of the required memory size
@@ -853,6 +860,10 @@ bool Node::outputShapeDataDependency() const {
     return false;
 }
 
+bool Node::shapeInferDataDependency(size_t port) const {
+    return shapeInference && ((shapeInference->get_port_mask() & (1 << port)) != 0U);
+}
+
 void Node::redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) {
     OPENVINO_ASSERT(newOutputShapes.size() == outputShapes.size(),
                     "Number shapes mismatch with real outputs number for node with name: ",
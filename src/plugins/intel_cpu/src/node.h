@@ -489,12 +489,18 @@ public:
     // but this requires changes in all the nodes. Since moving to a numa node right before an execute
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
-    void updateShapes();
+    /**
+     * @brief Infers and redefines the output shapes
+     * @param outputShapesMemo if not null, the memoized output shapes used instead of the shape inference when not
+     * empty, otherwise the inferred output shapes are stored there
+     */
+    void updateShapes(std::vector<VectorDims>* outputShapesMemo = nullptr);
     void updateDynamicParams();
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
     void redefineOutputMemory(size_t port, const VectorDims& new_output_shape) const;
     bool outputShapeDataDependency() const;
+    bool shapeInferDataDependency(size_t port) const;
 
     virtual void initSupportedPrimitiveDescriptors();
 
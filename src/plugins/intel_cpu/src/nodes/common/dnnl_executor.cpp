@@ -25,6 +25,10 @@ DnnlExecutorLegacy::DnnlExecutorLegacy(const dnnl::primitive_desc& pd) {
     scrch_md = DnnlExtensionUtils::makeDescriptor(pd.scratchpad_desc());
 }
 
+size_t DnnlExecutorLegacy::cacheCost() const {
+    return sizeof(*this) + DnnlExtensionUtils::query_primitive_cost(getPrimitiveDesc());
+}
+
 DnnlExecutorLegacy::IntermReorder::IntermReorder(const dnnl::memory::desc& descSrc,
                                                  const dnnl::memory::desc& descDst,
                                                  const dnnl::engine& engine)
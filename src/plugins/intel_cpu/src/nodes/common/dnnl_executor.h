@@ -8,6 +8,7 @@
 #include <onednn/iml_type_mapper.h>
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <cstddef>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <unordered_map>
 
@@ -42,6 +43,8 @@ public:
     dnnl::primitive getExecPrim() const;
     const_dnnl_primitive_desc_t getPrimitiveDesc() const;
     impl_desc_type getImplementationType() const;
+    // the footprint of the executor stored in the runtime cache
+    size_t cacheCost() const;
 
     DnnlMemoryDescPtr getSrcDesc() const {
         return src_md;
@@ -781,9 +781,14 @@ DnnlShapeAgnosticDataPtr DnnlConvolutionPrimitive::createShapeAgnosticData(const
     return std::make_shared<DnnlShapeAgnosticData>(postOpData.front());
 }
 
+size_t DnnlConvolutionPrimitive::cacheCost() const {
+    return sizeof(*this) + DnnlExtensionUtils::query_primitive_cost(m_primDesc.get());
+}
+
 void DnnlConvolutionPrimitive::execute(dnnl_primitive_args& primArgs) {
+    const auto& stream = DnnlExtensionUtils::threadStream(m_engine);
     if (m_intermediateReorders.empty()) {  // fast path
-        m_prim.execute(m_stream, primArgs);
+        m_prim.execute(stream, primArgs);
         return;
     }
 
@@ -794,8 +799,8 @@ void DnnlConvolutionPrimitive::execute(dnnl_primitive_args& primArgs) {
         auto& [primitive, dstMemoryDesc] = reorder;
         if (auto primArg = primArgs.find(id); primArg != primArgs.end()) {
             auto& [id, srcMemory] = *primArg;
-            dnnl::memory dstMemory(dstMemoryDesc, m_stream.get_engine());
-            primitive.execute(m_stream, srcMemory, dstMemory);
+            dnnl::memory dstMemory(dstMemoryDesc, m_engine);
+            primitive.execute(stream, srcMemory, dstMemory);
             originalMemory[id] = primArgs[id];
             primArgs[id] = dstMemory;
         }
@@ -805,17 +810,17 @@ void DnnlConvolutionPrimitive::execute(dnnl_primitive_args& primArgs) {
     if (auto outputReorder = outputReorders.find(DNNL_ARG_DST); outputReorder != outputReorders.end()) {
         auto& [id, reorder] = *outputReorder;
         auto& [primitive, srcMemoryDesc] = reorder;
-        dnnl::memory srcMemory(srcMemoryDesc, m_stream.get_engine());
+        dnnl::memory srcMemory(srcMemoryDesc, m_engine);
         originalMemory[id] = primArgs[id];
         primArgs[id] = srcMemory;
     }
 
-    m_prim.execute(m_stream, primArgs);
+    m_prim.execute(stream, primArgs);
     // execute intermediate dst reorders
     if (const auto& outputReorder = outputReorders.find(DNNL_ARG_DST); outputReorder != outputReorders.end()) {
         const auto& [id, reorder] = *outputReorder;
         const auto& primitive = reorder.m_reorder;
-        primitive.execute(m_stream, primArgs[id], originalMemory[id]);
+        primitive.execute(stream, primArgs[id], originalMemory[id]);
     }
     // restore original memory
     for (const auto& [id, mem] : originalMemory) {
@@ -1016,7 +1021,7 @@ DnnlConvolutionPrimitive::DnnlConvolutionPrimitive(const Key& key,
                                                    const dnnl::engine& engine,
                                                    const std::vector<impl_desc_type>& implPriorities,
                                                    const impl_desc_type defaultImplType)
-    : m_stream(dnnl::stream(engine)),
+    : m_engine(engine),
       m_primDesc(createPrimitiveDesc(key.src->getDnnlDesc(),
                                      key.wei->getDnnlDesc(),
                                      key.bias->getDnnlDesc(),
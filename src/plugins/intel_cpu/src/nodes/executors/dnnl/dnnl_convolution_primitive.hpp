@@ -63,6 +63,9 @@ class DnnlConvolutionPrimitive {
     };
 
 public:
+    // the primitive is immutable and executed on the stream of the calling thread, so it is shared by the CPU streams
+    static constexpr bool threadSafeCacheValue = true;
+
     DnnlConvolutionPrimitive(const Key& key,
                              const dnnl::engine& engine,
                              const std::vector<impl_desc_type>& implPriorities,
@@ -90,6 +93,9 @@ public:
         return m_implType;
     }
 
+    // the footprint of the primitive stored in the runtime cache
+    [[nodiscard]] size_t cacheCost() const;
+
     static DnnlMemoryDescPtr makeTransposedWeightDescriptor(const DnnlMemoryDescPtr& srcDesc,
                                                             const DnnlMemoryDescPtr& dstDesc,
                                                             const ConvAttrs& attrs);
@@ -123,7 +129,7 @@ public:
     static std::tuple<size_t, size_t, size_t, size_t> getChannelParams(const ConvConfig& config);
 
 private:
-    dnnl::stream m_stream;
+    dnnl::engine m_engine;
     dnnl::primitive_desc m_primDesc;
     impl_desc_type m_implType;
     DnnlMemoryDescPtr m_srcDesc;
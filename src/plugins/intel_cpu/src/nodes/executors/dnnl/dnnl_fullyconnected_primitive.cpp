@@ -473,7 +473,7 @@ static impl_desc_type implTypeFromPrimDesc(const dnnl::primitive_desc& primDesc)
 DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
                                  const dnnl::engine& engine,
                                  const std::vector<impl_desc_type>& implPriorities)
-    : m_stream(dnnl::stream(engine)),
+    : m_engine(engine),
       m_primDesc(createPrimitiveDesc(
           key.src->getDnnlDesc(),
           key.wei->getDnnlDesc(),
@@ -491,8 +491,12 @@ DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
+size_t DnnlFCPrimitive::cacheCost() const {
+    return sizeof(*this) + DnnlExtensionUtils::query_primitive_cost(m_primDesc.get());
+}
+
 void DnnlFCPrimitive::execute(const dnnl_primitive_args& primArgs) const {
-    m_prim.execute(m_stream, primArgs);
+    m_prim.execute(DnnlExtensionUtils::threadStream(m_engine), primArgs);
 }
 
 }  // namespace ov::intel_cpu
@@ -37,6 +37,9 @@ class DnnlFCPrimitive {
     };
 
 public:
+    // the primitive is immutable and executed on the stream of the calling thread, so it is shared by the CPU streams
+    static constexpr bool threadSafeCacheValue = true;
+
     DnnlFCPrimitive(const Key& key, const dnnl::engine& engine, const std::vector<impl_desc_type>& implPriorities);
 
     void execute(const dnnl_primitive_args& primArgs) const;
@@ -61,6 +64,9 @@ public:
         return m_implType;
     }
 
+    // the footprint of the primitive stored in the runtime cache
+    [[nodiscard]] size_t cacheCost() const;
+
     static DnnlShapeAgnosticDataPtr createShapeAgnosticData(const FCAttrs& attrs,
                                                             const MemoryArgs& memory,
                                                             const ExecutorContext::CPtr& context,
@@ -80,7 +86,7 @@ public:
                                                    const DnnlShapeAgnosticDataPtr& shapeAgnosticData);
 
 private:
-    dnnl::stream m_stream;
+    dnnl::engine m_engine;
     dnnl::primitive_desc m_primDesc;
     impl_desc_type m_implType;
     DnnlMemoryDescPtr m_srcDesc;
@@ -574,7 +574,7 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
                                          const dnnl::engine& engine,
                                          const std::vector<impl_desc_type>& implPriorities,
                                          const impl_desc_type defaultImplType)
-    : m_stream(dnnl::stream(engine)),
+    : m_engine(engine),
       m_primDesc(createPrimitiveDesc(key.src->getDnnlDesc(),
                                      key.wei->getDnnlDesc(),
                                      key.bias->getDnnlDesc(),
@@ -595,8 +595,12 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
+size_t DnnlMatMulPrimitive::cacheCost() const {
+    return sizeof(*this) + DnnlExtensionUtils::query_primitive_cost(m_primDesc.get());
+}
+
 void DnnlMatMulPrimitive::execute(const dnnl_primitive_args& primArgs) const {
-    m_prim.execute(m_stream, primArgs);
+    m_prim.execute(DnnlExtensionUtils::threadStream(m_engine), primArgs);
 }
 
 }  // namespace ov::intel_cpu
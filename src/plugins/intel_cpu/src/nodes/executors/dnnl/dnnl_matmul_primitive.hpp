@@ -39,6 +39,9 @@ class DnnlMatMulPrimitive {
     };
 
 public:
+    // the primitive is immutable and executed on the stream of the calling thread, so it is shared by the CPU streams
+    static constexpr bool threadSafeCacheValue = true;
+
     DnnlMatMulPrimitive(const Key& key,
                         const dnnl::engine& engine,
                         const std::vector<impl_desc_type>& implPriorities,
@@ -66,6 +69,9 @@ public:
         return m_implType;
     }
 
+    // the footprint of the primitive stored in the runtime cache
+    [[nodiscard]] size_t cacheCost() const;
+
     static bool useWeightsDecompressionImpl(ov::element::Type inputType, ov::element::Type weightsType);
 
     static DnnlShapeAgnosticDataPtr createShapeAgnosticData(const MatMulAttrs& attrs,
@@ -88,7 +94,7 @@ public:
                                                        const DnnlShapeAgnosticDataPtr& shapeAgnosticData);
 
 private:
-    dnnl::stream m_stream;
+    dnnl::engine m_engine;
     dnnl::primitive_desc m_primDesc;
     impl_desc_type m_implType;
     DnnlMemoryDescPtr m_srcDesc;
@@ -102,9 +102,17 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
-        ptr = MemoryPtr(
-            *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+        const auto key = DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc);
+        if (globalWeightCache->hasSharedStorage()) {
+            // the process local key is based on the weights address, so other processes need the content based one
+            auto getStorageKey = [&]() {
+                return DnnlExtensionUtils::computeWeightsContentHash(weightsMem, srcWeightDesc, dstWeightDesc) +
+                       (needShiftSignedToUnsigned ? "_shifted" : "");
+            };
+            ptr = MemoryPtr(*globalWeightCache->findOrCreate(key, create, getStorageKey, eng, dstWeightDesc));
+        } else {
+            ptr = MemoryPtr(*globalWeightCache->findOrCreate(key, create));
+        }
     } else {
         ptr = create();
     }
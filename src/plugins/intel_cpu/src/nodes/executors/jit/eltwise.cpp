@@ -342,14 +342,13 @@ void EltwiseJitExecutor::exec(const jit_eltwise_call_args_ptrs& args_ptrs, const
         });
     } else {
         // Execute Optimized Generic
-        if (m_kernel->jep_.use_runtime_ptrs) {
-            updateWorkAmount(dims_out);
-        }
+        const size_t workAmount =
+            m_kernel->jep_.use_runtime_ptrs ? getWorkAmount(dims_out) : m_schedulerWorkAmount;
 
         parallel_nt(m_threadsNum, [&](const int ithr, const int nthr) {
             size_t start = 0;
             size_t end = 0;
-            splitter(m_schedulerWorkAmount, nthr, ithr, start, end);
+            splitter(workAmount, nthr, ithr, start, end);
 
             std::vector<size_t> counters(dims_out.size() - 1, 0);
             auto args = jit_eltwise_call_args_indexes();
@@ -611,11 +610,12 @@ std::shared_ptr<EltwiseJitExecutor> EltwiseJitExecutor::create(const MemoryArgs&
     return executor;
 }
 
-void EltwiseJitExecutor::updateWorkAmount(const VectorDims& dims_out) {
-    m_schedulerWorkAmount = 1;
+size_t EltwiseJitExecutor::getWorkAmount(const VectorDims& dims_out) {
+    size_t workAmount = 1;
     for (size_t i = 0; i < dims_out.size() - 1; i++) {
-        m_schedulerWorkAmount *= dims_out[i];
+        workAmount *= dims_out[i];
     }
+    return workAmount;
 }
 
 }  // namespace ov::intel_cpu
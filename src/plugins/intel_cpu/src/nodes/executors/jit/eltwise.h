@@ -111,6 +111,9 @@ class EltwiseJitExecutor : public IEltwiseExecutor {
     };
 
 public:
+    // the kernel is immutable and the execution doesn't modify the executor, so it is shared by the CPU streams
+    static constexpr bool threadSafeCacheValue = true;
+
     EltwiseJitExecutor(const Key& key);
 
     void exec(const jit_eltwise_call_args_ptrs& args_ptrs, const VectorDims& dims_out) override;
@@ -144,7 +147,7 @@ private:
                           const ov::element::Type& outPrc,
                           const dnnl::post_ops& post_ops);
 
-    void updateWorkAmount(const VectorDims& dims_out);
+    static size_t getWorkAmount(const VectorDims& dims_out);
     void initializeDimsAndOffsets(const std::vector<VectorDims>& inpDims,
                                   const VectorDims& outBlkDims,
                                   [[maybe_unused]] const VectorDims& outOrder);
@@ -87,6 +87,14 @@ SubgraphCodeGenerator::SubgraphCodeGenerator(const std::shared_ptr<SubgraphAttrs
         std::make_shared<ov::snippets::Schedule>(snippet_attrs->snippet->generate(reinterpret_cast<const void*>(&jcp)));
 }
 
+size_t SubgraphCodeGenerator::cacheCost() const {
+    size_t cost = sizeof(*this);
+    if (schedule && schedule->lowering_result.compiled_snippet) {
+        cost += schedule->lowering_result.compiled_snippet->get_code_size();
+    }
+    return cost;
+}
+
 SubgraphBaseExecutor::SubgraphBaseExecutor(const std::shared_ptr<CPURuntimeConfig>& snippet_config,
                                            [[maybe_unused]] const std::shared_ptr<SubgraphAttrs>& snippet_attrs,
                                            const std::shared_ptr<SubgraphCodeGenerator>& snippet,
@@ -45,6 +45,9 @@ public:
         return schedule;
     }
 
+    // the footprint of the code generator stored in the runtime cache: the generated code dominates
+    [[nodiscard]] size_t cacheCost() const;
+
 private:
     std::shared_ptr<snippets::Schedule> schedule;
 };
@@ -303,21 +303,8 @@ void FullyConnected::prepareParams() {
 
 void FullyConnected::initTensorParallelSync() {
     if (tp_cfg.enable_tensor_parallel) {
-        tp_cfg.id = tp_cfg.sub_memory->get_memory_id(tp_cfg.w_rank);
+        tp_cfg.id = tp_cfg.sub_memory->acquire_memory(tp_cfg.w_rank);
         CPU_NODE_ASSERT(tp_cfg.id >= 0, "Tensor Parallel Config ID cannot be negative.");
-        tp_cfg.sub_memory->set_memory_used(tp_cfg.id, tp_cfg.w_rank);
-        while (true) {
-            std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
-            if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == tp_cfg.w_size) {
-                tp_cfg.sub_memory->_use_count[tp_cfg.id] = 0;
-                for (int i = 0; i < tp_cfg.w_size; i++) {
-                    tp_cfg.sub_memory->_memorys_table[tp_cfg.id][i].flag = false;
-                }
-            }
-            if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == 0) {
-                break;
-            }
-        }
     }
 }
 
@@ -352,62 +339,46 @@ void FullyConnected::execTensorParallelSync() {
         auto splited_dim_vec = split_parts(dims[dim], tp_cfg.w_size);
         const auto strideSize = splited_dim_vec[0] * prec.size();
 
-        tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].send_buf = cur_dst->getData();
-        tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].flag = true;
-
-        std::vector<int> wait_list(tp_cfg.w_size, 1);
-        while (true) {
-            int wait_size = 0;
-            for (int idx = 0; idx < tp_cfg.w_size; idx++) {
-                if (wait_list[idx] > 0 && tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].flag) {
-                    auto* new_ptr = static_cast<uint8_t*>(tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].send_buf);
-                    const auto copySize = splited_dim_vec[idx] * prec.size();  // bytes of half selected dim.
-                    const size_t unloop = 8;
-                    size_t step = count / unloop;
-                    parallel_for(step, [&](size_t i) {
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop) * channel_size,
-                                   new_ptr + (i * unloop) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 1) * channel_size,
-                                   new_ptr + (i * unloop + 1) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 2) * channel_size,
-                                   new_ptr + (i * unloop + 2) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 3) * channel_size,
-                                   new_ptr + (i * unloop + 3) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 4) * channel_size,
-                                   new_ptr + (i * unloop + 4) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 5) * channel_size,
-                                   new_ptr + (i * unloop + 5) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 6) * channel_size,
-                                   new_ptr + (i * unloop + 6) * copySize,
-                                   copySize);
-                        cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 7) * channel_size,
-                                   new_ptr + (i * unloop + 7) * copySize,
-                                   copySize);
-                    });
-                    size_t tail = count & ~(unloop - 1);
-                    for (size_t i = tail; i < count; ++i) {
-                        size_t dst_offset = i * channel_size + idx * strideSize;
-                        size_t src_offset = i * copySize;
-                        cpu_parallel_memcpy(dst_ptr + dst_offset, new_ptr + src_offset, copySize);
-                    }
-                    wait_list[idx] = 0;
-                }
-                wait_size += wait_list[idx];
+        tp_cfg.sub_memory->share_memory(tp_cfg.id, tp_cfg.w_rank, cur_dst->getData());
+        tp_cfg.sub_memory->for_each_shared_memory(tp_cfg.id, [&](int idx, void* send_buf) {
+            auto* new_ptr = static_cast<uint8_t*>(send_buf);
+            const auto copySize = splited_dim_vec[idx] * prec.size();  // bytes of half selected dim.
+            const size_t unloop = 8;
+            size_t step = count / unloop;
+            parallel_for(step, [&](size_t i) {
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop) * channel_size,
+                           new_ptr + (i * unloop) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 1) * channel_size,
+                           new_ptr + (i * unloop + 1) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 2) * channel_size,
+                           new_ptr + (i * unloop + 2) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 3) * channel_size,
+                           new_ptr + (i * unloop + 3) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 4) * channel_size,
+                           new_ptr + (i * unloop + 4) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 5) * channel_size,
+                           new_ptr + (i * unloop + 5) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 6) * channel_size,
+                           new_ptr + (i * unloop + 6) * copySize,
+                           copySize);
+                cpu_memcpy(dst_ptr + idx * strideSize + (i * unloop + 7) * channel_size,
+                           new_ptr + (i * unloop + 7) * copySize,
+                           copySize);
+            });
+            size_t tail = count & ~(unloop - 1);
+            for (size_t i = tail; i < count; ++i) {
+                size_t dst_offset = i * channel_size + idx * strideSize;
+                size_t src_offset = i * copySize;
+                cpu_parallel_memcpy(dst_ptr + dst_offset, new_ptr + src_offset, copySize);
             }
-            if (wait_size == 0) {
-                break;
-            }
-        }
-        {
-            std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
-            tp_cfg.sub_memory->_use_count[tp_cfg.id]++;
-        }
+        });
+        tp_cfg.sub_memory->release_memory(tp_cfg.id);
     }
 }
 
@@ -514,7 +514,11 @@ void Input::cloneBlobIfRequired() {
     bool has_subnormals = false;
     bool has_bf16_overflows = false;
 
-    checkSubnormalsAndBF16Overflows(has_subnormals, has_bf16_overflows);
+    // the constants of the models imported from the plugin blob have been checked on export, so the weights mapped
+    // from the blob are aliased without being read
+    if (!context->getConfig().constantsVerified) {
+        checkSubnormalsAndBF16Overflows(has_subnormals, has_bf16_overflows);
+    }
 
     auto cloneBlob = [&, this]() {
         MemoryPtr memory;
@@ -72,9 +72,12 @@ static void attn_memcpy_kernel(const ov::intel_cpu::PlainTensor& k_input,
     size_t L1 = k_input.m_dims[2];
     size_t S = k_input.m_dims[3];
     size_t SV = v_input.m_dims[3];
+    // the rows of the u4 cache are copied as the packed bytes
+    const size_t k_row_bytes = S * k_input.m_element_size / k_input.m_sub_byte_multiplier;
+    const size_t v_row_bytes = SV * v_input.m_element_size / v_input.m_sub_byte_multiplier;
     parallel_for3d(L1, B, H, [&](size_t m, size_t b, size_t h) {
-        std::memcpy(past_k_output.ptr_v(b, h, m, 0), k_input.ptr_v(b, h, m, 0), S * k_input.m_element_size);
-        std::memcpy(past_v_output.ptr_v(b, h, m, 0), v_input.ptr_v(b, h, m, 0), SV * v_input.m_element_size);
+        std::memcpy(past_k_output.ptr_v(b, h, m, 0), k_input.ptr_v(b, h, m, 0), k_row_bytes);
+        std::memcpy(past_v_output.ptr_v(b, h, m, 0), v_input.ptr_v(b, h, m, 0), v_row_bytes);
     });
 }
 
@@ -270,6 +270,41 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
     });
 }
 
+// the u4 cache is quantized by token only, two values are packed into a byte
+template <typename T>
+static void attn_quant_u4_mt(const ov::intel_cpu::PlainTensor& k_src,
+                             const ov::intel_cpu::PlainTensor& v_src,
+                             const ov::intel_cpu::PlainTensor& k_dst,
+                             const ov::intel_cpu::PlainTensor& v_dst,
+                             const size_t L0,
+                             const ov::intel_cpu::PlainTensor& k_scale_zp,
+                             const ov::intel_cpu::PlainTensor& v_scale_zp,
+                             const size_t key_group_size,
+                             const size_t value_group_size) {
+    size_t B = k_src.m_dims[0];
+    size_t H = k_src.m_dims[1];
+    size_t L1 = k_src.m_dims[2];
+    size_t S = k_src.m_dims[3];
+    size_t SV = v_src.m_dims[3];
+    parallel_for3d(L1, B, H, [&](size_t m, size_t b, size_t h) {
+        auto* p_k = k_scale_zp.ptr<float>(L0 + m, b, h);
+        for (size_t group_id = 0; group_id < S / key_group_size; group_id++) {
+            quantize<T, ov::element::u4>(k_src.ptr<T>(b, h, m, group_id * key_group_size),
+                                         k_dst.ptr<uint8_t, ov::element::u4>(b, h, L0 + m, group_id * key_group_size),
+                                         key_group_size,
+                                         p_k + group_id * 2);
+        }
+        auto* p_v = v_scale_zp.ptr<float>(L0 + m, b, h);
+        for (size_t group_id = 0; group_id < SV / value_group_size; group_id++) {
+            quantize<T, ov::element::u4>(
+                v_src.ptr<T>(b, h, m, group_id * value_group_size),
+                v_dst.ptr<uint8_t, ov::element::u4>(b, h, L0 + m, group_id * value_group_size),
+                value_group_size,
+                p_v + group_id * 2);
+        }
+    });
+}
+
 template <typename T, ov::element::Type_t KEY_DST_PREC, ov::element::Type_t VALUE_DST_PREC>
 static void saged_attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                                 const ov::intel_cpu::PlainTensor& v_src,
@@ -440,6 +475,33 @@ void attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                                             quant_k_by_channel,
                                             k_group_size,
                                             v_group_size);
+    } else if (k_dst.get_precision() == ov::element::u4) {
+        OPENVINO_ASSERT(!quant_k_by_channel, "u4 key cache quantized by channel is not supported in attn_quantkv");
+        if (k_src.get_precision() == ov::element::f32) {
+            attn_quant_u4_mt<float>(k_src, v_src, k_dst, v_dst, L0, k_scale_zp, v_scale_zp, k_group_size, v_group_size);
+        } else if (k_src.get_precision() == ov::element::bf16) {
+            attn_quant_u4_mt<ov::bfloat16>(k_src,
+                                           v_src,
+                                           k_dst,
+                                           v_dst,
+                                           L0,
+                                           k_scale_zp,
+                                           v_scale_zp,
+                                           k_group_size,
+                                           v_group_size);
+        } else if (k_src.get_precision() == ov::element::f16) {
+            attn_quant_u4_mt<ov::float16>(k_src,
+                                          v_src,
+                                          k_dst,
+                                          v_dst,
+                                          L0,
+                                          k_scale_zp,
+                                          v_scale_zp,
+                                          k_group_size,
+                                          v_group_size);
+        } else {
+            OPENVINO_THROW("unsupport src type: ", k_src.get_precision(), ", dst type: u4 in attn_quantkv");
+        }
     } else {
         OPENVINO_THROW("unsupport src type: ",
                        k_src.get_precision(),
@@ -574,6 +636,14 @@ void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float* params) {
     attn_dequant_kernel<float, ov::element::u8>(src, dst, n, params);
 }
 
+void attn_quant_u4(const float* src, void* dst, size_t n, float& scale, float& zp) {
+    quant_u4(src, dst, n, scale, zp);
+}
+// u4 dequant needs scale + zp, params points to float[2]
+void attn_dequant_u4(const void* src, float* dst, size_t n, float* params) {
+    attn_dequant_kernel<float, ov::element::u4>(src, dst, n, params);
+}
+
 void attn_quant_by_channel_u8(const float* src,
                               uint8_t* dst,
                               size_t seq_dim,
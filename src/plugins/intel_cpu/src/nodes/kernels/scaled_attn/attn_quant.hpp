@@ -48,6 +48,10 @@ void attn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float
 
 void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float* params);
 
+void attn_quant_u4(const float* src, void* dst, size_t n, float& scale, float& zp);
+
+void attn_dequant_u4(const void* src, float* dst, size_t n, float* params);
+
 void attn_quant_by_channel_u8(const float* src,
                               uint8_t* dst,
                               size_t seq_dim,
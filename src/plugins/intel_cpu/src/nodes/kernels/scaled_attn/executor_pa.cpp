@@ -539,6 +539,35 @@ struct ScoreAggregationInfo {
     int32_t kv_len_aligned;         // tmp buffer length for current block
 };
 
+struct SparseMaskInfo {
+    size_t offset;    // offset of the mask [H, q_blocks, k_blocks] of current sequence in the whole buffer
+    size_t q_blocks;  // number of query blocks of xattention_block_size tokens, 0 for the dense attention
+    size_t k_blocks;  // number of key blocks of xattention_block_size tokens
+};
+
+static inline float dot_product_f32(const float* a, const float* b, size_t n) {
+    size_t i = 0;
+    float sum = 0.0F;
+#    if defined(HAVE_AVX512F)
+    auto vsum = _mm512_setzero_ps();
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        vsum = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), vsum);
+    }
+    sum = _mm512_reduce_add_ps(vsum);
+#    elif defined(HAVE_AVX2)
+    auto vsum = _mm256_setzero_ps();
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        vsum = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), vsum);
+    }
+    hsum(vsum);
+    sum = _mm256_cvtss_f32(vsum);
+#    endif
+    for (; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
 template <typename DATA_TYPE, ov::element::Type_t KEY_PREC, ov::element::Type_t VALUE_PREC>
 struct MHAHelper {
     // initialize once
@@ -584,6 +613,17 @@ struct MHAHelper {
 
     PlainTensor _block_rotation_coefficient_scratch;
 
+    // block-sparse prefill
+    size_t _sparse_block_size = 0UL;
+    size_t _sparse_stride = 0UL;
+    std::vector<SparseMaskInfo> _sparse_infos;  // empty if all the sequences are dense
+    PlainTensor _sparse_mask;                   // u8 masks of the key blocks to compute, concatenated for all sequences
+    PlainTensor _sparse_keys;                   // [kv_len, S] f32 keys of one key head
+    PlainTensor _sparse_scratch;                // [nthr, stride * S + kv_len / stride + k_blocks] f32
+    PlainTensor _sparse_order;                  // [nthr, k_blocks] i32
+
+    PagedAttnProfiler* _profiler = nullptr;  // collects the phase times if set
+
     MHAHelper() {
         _weight.resize<float>({size_t{1}, size_t{1}, size_t{1}, size_t{1}});
     }
@@ -806,6 +846,194 @@ struct MHAHelper {
         });
     }
 
+    // XAttention block-sparse prefill: the attention of every block of xattention_block_size queries and keys is
+    // estimated by the sums of its antidiagonals sampled with xattention_stride. The key blocks of every query block
+    // are kept in the descending order of their estimated attention mass until the kept mass reaches the threshold
+    // of the sequence, the first key block and the key blocks on the diagonal are always kept.
+    //  query: [B_token, H * S]
+    //  key_cache: [block_number, Hk, 32, S]
+    void init_sparse_masks(const PlainTensor& query,
+                           const PlainTensor& key_cache,
+                           const PlainTensor& past_lens,
+                           const PlainTensor& subsequence_begins,
+                           const PlainTensor& block_indices,
+                           const PlainTensor& block_indices_begins,
+                           const PlainTensor& xattention_threshold,
+                           size_t xattention_block_size,
+                           size_t xattention_stride) {
+        _sparse_infos.clear();
+        if (!xattention_threshold || _params.is_sage_attn) {
+            return;
+        }
+        OPENVINO_ASSERT(xattention_block_size % _block_size == 0,
+                        "CPU: xattention block size must be multiple of ",
+                        _block_size,
+                        ", current: ",
+                        xattention_block_size);
+        OPENVINO_ASSERT(xattention_block_size % xattention_stride == 0,
+                        "CPU: xattention block size must be multiple of xattention stride ",
+                        xattention_stride,
+                        ", current: ",
+                        xattention_block_size);
+        _sparse_block_size = xattention_block_size;
+        _sparse_stride = xattention_stride;
+
+        const auto seq_count = past_lens.m_dims[0];
+        std::vector<SparseMaskInfo> infos(seq_count, SparseMaskInfo{0, 0, 0});
+        size_t total_size = 0;
+        size_t max_kv_len = 0;
+        for (size_t b = 0; b < seq_count; b++) {
+            const auto q_len = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b + 1] -
+                                                   subsequence_begins.ptr<int32_t>()[b]);
+            const auto kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + q_len;
+            const auto k_blocks = div_up(kv_len, _sparse_block_size);
+            // decoding and the prompts having only the first and the diagonal key blocks are dense
+            if (xattention_threshold.ptr<float>()[b] <= 0.0F || q_len == 1 || k_blocks <= 2) {
+                continue;
+            }
+            infos[b] = {total_size, div_up(q_len, _sparse_block_size), k_blocks};
+            total_size += H * infos[b].q_blocks * k_blocks;
+            max_kv_len = std::max(max_kv_len, kv_len);
+        }
+        if (total_size == 0) {
+            return;
+        }
+        _sparse_infos = std::move(infos);
+        const auto max_k_blocks = div_up(max_kv_len, _sparse_block_size);
+        _sparse_mask.resize<uint8_t>({total_size});
+        _sparse_keys.resize<float>({max_kv_len, S});
+        _sparse_scratch.resize<float>({_nthr, _sparse_stride * S + max_kv_len / _sparse_stride + max_k_blocks});
+        _sparse_order.resize<int32_t>({_nthr, max_k_blocks});
+
+        for (size_t b = 0; b < seq_count; b++) {
+            const auto& info = _sparse_infos[b];
+            if (info.q_blocks == 0) {
+                continue;
+            }
+            const auto batch_in_token = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b]);
+            const auto q_len = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b + 1]) - batch_in_token;
+            const auto past_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]);
+            const auto kv_len = past_len + q_len;
+            const auto threshold = xattention_threshold.ptr<float>()[b];
+            const auto* block_table = block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[b];
+            for (size_t hk = 0; hk < Hk; hk++) {
+                parallel_for(div_up(kv_len, _block_size), [&](size_t kv_blk) {
+                    load_sparse_keys(_sparse_keys.ptr<float>(kv_blk * _block_size),
+                                     key_cache,
+                                     block_table[kv_blk],
+                                     hk,
+                                     std::min(_block_size, kv_len - kv_blk * _block_size));
+                });
+                parallel_for2d_dynamic(_h_each_group_len, info.q_blocks, [&](size_t h_in_group, size_t q_blk) {
+                    const auto h = hk * _h_each_group_len + h_in_group;
+                    const auto ithr = static_cast<size_t>(parallel_get_thread_num());
+                    auto* mask =
+                        _sparse_mask.ptr<uint8_t>() + info.offset + (h * info.q_blocks + q_blk) * info.k_blocks;
+                    estimate_sparse_mask(mask,
+                                         query.ptr<DATA_TYPE>(batch_in_token) + h * S,
+                                         query.stride(0),
+                                         ithr,
+                                         q_blk,
+                                         q_len,
+                                         past_len,
+                                         threshold);
+                });
+            }
+        }
+    }
+
+    void load_sparse_keys(float* dst, const PlainTensor& key_cache, int32_t block_number, size_t hk, size_t valid_len) {
+        if constexpr (any_of(KEY_PREC, ov::element::u8, ov::element::u4)) {
+            dequant<float, KEY_PREC>(
+                dst,
+                key_cache.ptr<typename ov::element_type_traits<KEY_PREC>::value_type, KEY_PREC>(block_number, hk),
+                valid_len,
+                S,
+                valid_len,
+                _params.key_group_size,
+                _params.quant_key_bychannel);
+        } else if constexpr (KEY_PREC != ov::element::i8) {
+            cvt_copy(dst,
+                     key_cache.ptr<typename ov::element_type_traits<KEY_PREC>::value_type>(block_number, hk),
+                     1,
+                     valid_len * S,
+                     0,
+                     0);
+        }
+    }
+
+    // the mask of the key blocks for one query block of one head, q_ptr points to the first query of the sequence
+    void estimate_sparse_mask(uint8_t* mask,
+                              const DATA_TYPE* q_ptr,
+                              size_t q_stride,
+                              size_t ithr,
+                              size_t q_blk,
+                              size_t q_len,
+                              size_t past_len,
+                              float threshold) {
+        const auto q_start = q_blk * _sparse_block_size;
+        const auto q_end = std::min(q_start + _sparse_block_size, q_len);
+        const auto rows = (q_end - q_start) / _sparse_stride;
+        // the key blocks from the diagonal to the end are visible to the query block
+        const auto diag_begin = (past_len + q_start) / _sparse_block_size;
+        const auto k_blocks = div_up(past_len + q_end, _sparse_block_size);
+        const auto strided_len = _sparse_stride * S;
+        auto* q_strided = _sparse_scratch.ptr<float>(ithr);
+        auto* scores = q_strided + strided_len;
+        auto* mass = scores + _sparse_keys.m_dims[0] / _sparse_stride;
+        std::fill(mass, mass + k_blocks, 0.0F);
+        for (size_t r = 0; r < rows; r++) {
+            // the queries of the row go in the reversed order, so the product with the strided keys sums antidiagonals
+            const auto q_row = q_start + r * _sparse_stride;
+            for (size_t i = 0; i < _sparse_stride; i++) {
+                cvt_copy(q_strided + i * S, q_ptr + (q_row + _sparse_stride - 1 - i) * q_stride, 1, S, 0, 0);
+            }
+            // the strided keys visible to the last query of the row
+            const auto cols = (past_len + q_row + _sparse_stride) / _sparse_stride;
+            float max_score = -FLT_MAX;
+            for (size_t c = 0; c < cols; c++) {
+                scores[c] = dot_product_f32(q_strided, _sparse_keys.ptr<float>(c * _sparse_stride), strided_len) *
+                            _d_scale / static_cast<float>(_sparse_stride);
+                max_score = std::max(max_score, scores[c]);
+            }
+            float sum = 0.0F;
+            for (size_t c = 0; c < cols; c++) {
+                scores[c] = std::exp(scores[c] - max_score);
+                sum += scores[c];
+            }
+            for (size_t c = 0; c < cols; c++) {
+                mass[c * _sparse_stride / _sparse_block_size] += scores[c] / sum;
+            }
+        }
+
+        std::fill(mask, mask + k_blocks, 1);
+        // the threshold of 1 keeps every block, whatever the rounding of the kept mass is
+        if (rows == 0 || threshold >= 1.0F) {
+            return;
+        }
+        float total = 0.0F;
+        float kept = mass[0];
+        for (size_t k_blk = 0; k_blk < k_blocks; k_blk++) {
+            total += mass[k_blk];
+            if (k_blk >= diag_begin) {
+                kept += mass[k_blk];
+            }
+        }
+        auto* order = _sparse_order.ptr<int32_t>(ithr);
+        size_t candidates = 0;
+        for (size_t k_blk = 1; k_blk < diag_begin; k_blk++) {
+            order[candidates++] = static_cast<int32_t>(k_blk);
+            mask[k_blk] = 0;
+        }
+        std::sort(order, order + candidates, [&](int32_t a, int32_t b) {
+            return mass[a] > mass[b];
+        });
+        for (size_t i = 0; i < candidates && kept < threshold * total; i++) {
+            mask[order[i]] = 1;
+            kept += mass[order[i]];
+        }
+    }
+
     // compute one block(such as 32 tokens) of query in M dimension: softmax(q_block*k')*v
     // all tensors such as query... have no batch dimension because batch dimension is varying
     //  query: [H, L, S]
@@ -829,7 +1057,8 @@ struct MHAHelper {
                               const PlainTensor& alibi_slopes,
                               float* score_output,
                               size_t q_start_idx_score,
-                              const ScoreAggregationInfo* score_info_ptr) {
+                              const ScoreAggregationInfo* score_info_ptr,
+                              const SparseMaskInfo* sparse_info_ptr) {
         auto q_start = q_blk * _block_size;
         auto q_end = std::min(q_start + _block_size, q_len);
         auto q_cnt = q_end - q_start;
@@ -837,7 +1066,18 @@ struct MHAHelper {
         constexpr bool q_cache_is_same = precision_of<DATA_TYPE>::value == VALUE_PREC;
         auto cur_kv_len_blocks = div_up(cur_kv_len, _block_size);
         for (size_t h = hq_beg; h < hq_end; h++) {
+            PagedAttnProfiler::PhaseTimer timer(_profiler, ithr);
             auto* q_ptr = query.ptr<DATA_TYPE>(h, q_start, 0);
+            // the key blocks skipped by the block-sparse prefill
+            const uint8_t* sparse_mask = nullptr;
+            if (sparse_info_ptr) {
+                const auto q_blk_sparse = q_start / _sparse_block_size;
+                sparse_mask = _sparse_mask.ptr<uint8_t>() + sparse_info_ptr->offset +
+                              (h * sparse_info_ptr->q_blocks + q_blk_sparse) * sparse_info_ptr->k_blocks;
+            }
+            auto is_skipped = [&](size_t k_blk) {
+                return sparse_mask && !sparse_mask[k_blk * _block_size / _sparse_block_size];
+            };
             if (_params.is_sage_attn) {
                 // local_q shape [block_size, S + sizeof(float)]
                 auto local_q = _quantized_q.slice(0, ithr, ithr + 1).reshape({_block_size, S + sizeof(float)});
@@ -851,6 +1091,13 @@ struct MHAHelper {
             // 1 1 1 0 ...
             // just computing the positions of 1 should be enough
             for (size_t k_blk = 0; k_blk < cur_kv_len_blocks; k_blk++) {
+                if (is_skipped(k_blk)) {
+                    // the scores of the skipped block vanish after softmax
+                    for (size_t m = 0; m < q_cnt; m++) {
+                        std::fill_n(c_ptr + m * _weight.stride(2) + k_blk * _block_size, _block_size, -FLT_MAX);
+                    }
+                    continue;
+                }
                 if (_params.is_sage_attn) {
 #    if defined(OPENVINO_ARCH_X86_64)
                     auto* q_ptr = _quantized_q.ptr<int8_t>(ithr);
@@ -879,6 +1126,7 @@ struct MHAHelper {
                                                      _qk_scratch_a ? _qk_scratch_a.ptr<DATA_TYPE>(ithr, 0) : nullptr);
                 }
             }
+            timer.stop(PagedAttnProfiler::QK);
 
             for (size_t m = q_start; m < q_end; m++) {
                 // apply attention mask & sofmax
@@ -944,6 +1192,7 @@ struct MHAHelper {
                             0);
                 }
             }
+            timer.stop(PagedAttnProfiler::SOFTMAX);
 
             // reuse float buffer, need to use float to compute offset
             auto* w_ptr = reinterpret_cast<DATA_TYPE*>(_weight.ptr<float>(ithr, h - hq_beg, 0, 0));
@@ -952,6 +1201,10 @@ struct MHAHelper {
 
             // for each weight block, loop through all value block
             for (size_t v_blk = 0; v_blk < cur_kv_len_blocks; v_blk++) {
+                // the first block initializes the output, it is never skipped
+                if (is_skipped(v_blk)) {
+                    continue;
+                }
                 DATA_TYPE* v_ptr = nullptr;
                 if (q_is_xf16 || !q_cache_is_same) {
                     v_ptr = wv_scratch_b.ptr<DATA_TYPE>(v_blk, hk);
@@ -989,6 +1242,7 @@ struct MHAHelper {
                                      SV,
                                      q_cnt);
             }
+            timer.stop(PagedAttnProfiler::SV);
         }
     }
 #    if defined(OPENVINO_ARCH_ARM64)
@@ -1156,6 +1410,7 @@ struct MHAHelper {
                             size_t cur_kv_len,
                             const PlainTensor& alibi_slopes,
                             float* score_output) {
+        PagedAttnProfiler::PhaseTimer timer(_profiler, ithr);
 #    if defined(OPENVINO_ARCH_X86_64)
         if (any_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
             _gemv->tile_config();
@@ -1202,6 +1457,7 @@ struct MHAHelper {
 #    if defined(OPENVINO_ARCH_X86_64)
         }
 #    endif
+        timer.stop(PagedAttnProfiler::QK);
 
         for (size_t pq = 0; pq < q_len; pq++) {
             for (size_t h = hq_beg; h < hq_end; h++) {
@@ -1233,6 +1489,7 @@ struct MHAHelper {
                 }
             }
         }
+        timer.stop(PagedAttnProfiler::SOFTMAX);
 
         memset(_output.ptr<float>(ithr), 0, q_len * H * SV * sizeof(float));
         for (size_t pv = 0, i = 0; pv < cur_kv_len; pv += _block_size, i++) {
@@ -1268,6 +1525,7 @@ struct MHAHelper {
                 cvt_copy(output_emb.ptr<DATA_TYPE>(pq, h * SV), _output.ptr<float>(ithr, pq, h), 1, SV, 0, 0);
             }
         }
+        timer.stop(PagedAttnProfiler::SV);
     }
 
     // compute one token, loop along batch, head dimensions and kv_len, it's special for very long kv_len with small
@@ -1326,6 +1584,7 @@ struct MHAHelper {
                 }
             };
         auto loop_qk = [&](size_t b, size_t pk_in_blocks, size_t hx) {
+            PagedAttnProfiler::PhaseTimer timer(_profiler, static_cast<size_t>(parallel_get_thread_num()));
             auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
             size_t hk = 0;
             size_t hq_beg = 0;
@@ -1377,9 +1636,11 @@ struct MHAHelper {
                 }
 #    endif
             }
+            timer.stop(PagedAttnProfiler::QK);
         };
 
         auto loop_softmax = [&](size_t b, size_t h, size_t pq) {
+            PagedAttnProfiler::PhaseTimer timer(_profiler, static_cast<size_t>(parallel_get_thread_num()));
             auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
             auto ncausal = cur_kv_len;
             // apply attention mask & sofmax
@@ -1401,6 +1662,7 @@ struct MHAHelper {
                                        ov::element::f32,
                                        ov::element::f32,
                                        alibi_slope);
+            timer.stop(PagedAttnProfiler::SOFTMAX);
         };
 
         size_t h_dims = loop_hk ? Hk : H;
@@ -1434,6 +1696,7 @@ struct MHAHelper {
         });
 
         auto loop_wk = [&](size_t b, size_t pv_in_blocks, size_t hx) {
+            PagedAttnProfiler::PhaseTimer timer(_profiler, static_cast<size_t>(parallel_get_thread_num()));
             auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
             auto pv = pv_in_blocks * _block_size;
             size_t hk = 0;
@@ -1469,6 +1732,7 @@ struct MHAHelper {
                     }
                 }
             }
+            timer.stop(PagedAttnProfiler::SV);
         };
 
         if (prefer_static_loop) {
@@ -1478,10 +1742,12 @@ struct MHAHelper {
         }
 
         parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
+            PagedAttnProfiler::PhaseTimer timer(_profiler, static_cast<size_t>(parallel_get_thread_num()));
             auto* temp = _output_bhl.ptr<float>(b, 0, h, pq);
             size_t temp_stride = _output_bhl.stride(1);  // split with pv_in_blocks steps
             auto* dst = output_emb.ptr<DATA_TYPE>(b, pq, h * SV);
             attn_reduce(dst, temp, kv_len_in_blocks, SV, temp_stride);
+            timer.stop(PagedAttnProfiler::SV);
         });
     }
 };
@@ -1531,6 +1797,7 @@ struct MHA {
             }
 
             const auto ithr = static_cast<size_t>(parallel_get_thread_num());
+            PagedAttnProfiler::PhaseTimer timer(_helper._profiler, ithr);
             const size_t valid_len = item.valid_block_len;
             if (_helper._params.is_sage_attn) {
 #    if defined(OPENVINO_ARCH_X86_64)
@@ -1610,6 +1877,7 @@ struct MHA {
                     }
                 }
             }
+            timer.stop(PagedAttnProfiler::REORDER);
         });
 
         // loop along HK dimension: if mixed first/second token and elements count is enough, loop HK to reuse KV in the
@@ -1694,6 +1962,11 @@ struct MHA {
                     }
                 }
 
+                const SparseMaskInfo* sparse_info_ptr = nullptr;
+                if (!_helper._sparse_infos.empty() && _helper._sparse_infos[batch_in_seq].q_blocks > 0) {
+                    sparse_info_ptr = &_helper._sparse_infos[batch_in_seq];
+                }
+
                 PlainTensor sub_query;
 
                 sub_query.resize({q_len, _helper.H, _helper.S}, q.ptr<DATA_TYPE>(batch_in_token));
@@ -1739,7 +2012,8 @@ struct MHA {
                         alibi_slopes,
                         score_output,
                         q_start_idx_score,
-                        score_info_ptr);
+                        score_info_ptr,
+                        sparse_info_ptr);
                 }
 #    else
                 _helper.exec_kernel_multiple(
@@ -1760,7 +2034,8 @@ struct MHA {
                     alibi_slopes,
                     score_output,
                     q_start_idx_score,
-                    score_info_ptr);
+                    score_info_ptr,
+                    sparse_info_ptr);
 #    endif
             }
         });
@@ -2175,6 +2450,7 @@ struct AttentionExecutor : public PagedAttentionExecutor {
              output_emb,
              output_score);
 
+        PagedAttnProfiler::PhaseTimer timer(_helper._profiler, 0);
         if (rotated_block_indices) {
             // Rotate kv cache currently doesn't support quantized cache.
             // for u8 it only supports compilation but throws exception in the runtime
@@ -2187,6 +2463,16 @@ struct AttentionExecutor : public PagedAttentionExecutor {
         }
 
         concat_pastkv(k, v, k_cache, v_cache, past_lens, subsequence_begins, block_indices, block_indices_begins);
+        timer.stop(PagedAttnProfiler::KV_UPDATE, _helper._nthr);
+        _helper.init_sparse_masks(q,
+                                  k_cache,
+                                  past_lens,
+                                  subsequence_begins,
+                                  block_indices,
+                                  block_indices_begins,
+                                  xattention_threshold,
+                                  static_cast<size_t>(xattention_block_size),
+                                  static_cast<size_t>(xattention_stride));
 
         _kernel(q,
                 k_cache,
@@ -2201,6 +2487,10 @@ struct AttentionExecutor : public PagedAttentionExecutor {
                 alibi_slopes,
                 score_aggregation_window);
     }
+
+    void set_profiler(PagedAttnProfiler* profiler) override {
+        _helper._profiler = profiler;
+    }
 };
 #endif
 
@@ -5,6 +5,8 @@
 
 #include <xbyak/xbyak.h>
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <openvino/core/type/element_type.hpp>
@@ -19,6 +21,77 @@ namespace ov::Extensions::Cpu {
 
 // this file will contain features that do not require multiple instantiation
 
+// accumulates the time spent by the threads in every phase of the PagedAttention execution, the collection is enabled
+// only if the profiler is set to the executor (used by the PagedAttention micro-benchmark)
+class PagedAttnProfiler {
+public:
+    enum Phase : uint8_t { KV_UPDATE, REORDER, QK, SOFTMAX, SV, PHASE_COUNT };
+
+    // measures the consecutive phases run by one thread, does nothing if there is no profiler
+    class PhaseTimer {
+    public:
+        PhaseTimer(PagedAttnProfiler* profiler, size_t ithr) : m_profiler(profiler), m_ithr(ithr) {
+            if (m_profiler) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        // accounts the time since the previous stop to the phase, the phase run by the parallel region is accounted
+        // for all its threads
+        void stop(Phase phase, size_t threads_num = 1) {
+            if (m_profiler) {
+                auto now = std::chrono::steady_clock::now();
+                auto threads = static_cast<std::chrono::steady_clock::rep>(threads_num);
+                m_profiler->add(m_ithr, phase, (now - m_start) * threads);
+                m_start = now;
+            }
+        }
+
+    private:
+        PagedAttnProfiler* m_profiler;
+        size_t m_ithr;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    explicit PagedAttnProfiler(size_t nthr) : m_times(nthr) {}
+
+    void add(size_t ithr, Phase phase, std::chrono::steady_clock::duration duration) {
+        m_times[ithr].ns[phase] +=
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    // the phase time summed over the threads
+    [[nodiscard]] double get_ms(Phase phase) const {
+        uint64_t total = 0;
+        for (const auto& times : m_times) {
+            total += times.ns[phase];
+        }
+        return static_cast<double>(total) * 1e-6;
+    }
+
+    [[nodiscard]] size_t get_threads_num() const {
+        return m_times.size();
+    }
+
+    void reset() {
+        for (auto& times : m_times) {
+            times.ns.fill(0);
+        }
+    }
+
+    static const char* get_name(Phase phase) {
+        static constexpr std::array<const char*, PHASE_COUNT> names{"kv_update", "reorder", "qk", "softmax", "sv"};
+        return names[phase];
+    }
+
+private:
+    // aligned to cache line to avoid false sharing
+    struct alignas(64) ThreadTimes {
+        std::array<uint64_t, PHASE_COUNT> ns{};
+    };
+    std::vector<ThreadTimes> m_times;
+};
+
 struct PagedAttentionExecutor {
     // PagedAttention input index
     static const size_t ID_Q = 0;                          // [B_token, H * S], float
@@ -43,6 +116,8 @@ struct PagedAttentionExecutor {
     static const size_t ID_XATTENTION_STRIDE = 19;         // [], int32
     virtual void execute(const std::vector<ov::intel_cpu::MemoryPtr>& inputs,
                          std::vector<ov::intel_cpu::MemoryPtr> outputs) = 0;
+    // the profiler must outlive the executions, nullptr disables the profiling
+    virtual void set_profiler([[maybe_unused]] PagedAttnProfiler* profiler) {}
     virtual ~PagedAttentionExecutor() = default;
 };
 
@@ -1,10 +1,12 @@
 // Copyright (C) 2018-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 #include "openvino/core/except.hpp"
@@ -17,6 +19,7 @@
 #    include <immintrin.h>
 #endif
 
+#include "common.hpp"
 #include "mha_single_token.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/bfloat16.hpp"
@@ -30,6 +33,20 @@ namespace ov::Extensions::Cpu::XARCH {
 
 using namespace ov;
 
+// element of the u4 KV cache, a byte holds two values: the even one in the high half, the odd one in the low half
+struct u4_pair {
+    uint8_t data;
+};
+
+template <typename T, typename... Is>
+static T* kv_cache_ptr(const ov::intel_cpu::PlainTensor& cache, Is... indices) {
+    if constexpr (std::is_same_v<T, u4_pair>) {
+        return cache.ptr<T, ov::element::u4>(indices...);
+    } else {
+        return cache.ptr<T>(indices...);
+    }
+}
+
 #if defined(HAVE_AVX2)
 
 #    define prefetch_bytes(bytes, sel, advance, src) \
@@ -388,6 +405,56 @@ static void attn_acc_value(float* out, float weight, uint8_t* v, size_t S, float
     }
 }
 
+// the u4 values are dequantized in registers, so the cache is read at half of the u8 bandwidth
+static void attn_acc_value(float* out, float weight, u4_pair* v, size_t S, float* scale, float* zp, size_t group_size) {
+    auto* v_u4 = reinterpret_cast<uint8_t*>(v);
+    size_t group_id = 0;
+    while (group_id < S / group_size) {
+        size_t i = 0;
+        float group_scale = *(scale + group_id * 2);
+        float group_zp = *(zp + group_id * 2);
+        size_t offset = group_id * group_size;
+#if defined(HAVE_AVX512F)
+        auto attn_w_vec_fp32 = _mm512_set1_ps(weight * group_scale);
+        auto v_zp = _mm512_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx512 <= group_size; i += 2 * vec_len_f32_avx512) {
+            __m512 v0_value;
+            __m512 v1_value;
+            mm512_loadu_u4_to_f32(v_u4 + (offset + i) / 2, v0_value, v1_value);
+            auto v0_out = mm512_uni_loadu_ps(out + offset + i);
+            auto v1_out = mm512_uni_loadu_ps(out + offset + i + vec_len_f32_avx512);
+            v0_value = _mm512_sub_ps(v0_value, v_zp);
+            v1_value = _mm512_sub_ps(v1_value, v_zp);
+            v0_out = _mm512_fmadd_ps(attn_w_vec_fp32, v0_value, v0_out);
+            v1_out = _mm512_fmadd_ps(attn_w_vec_fp32, v1_value, v1_out);
+            mm512_uni_storeu_ps(out + offset + i, v0_out);
+            mm512_uni_storeu_ps(out + offset + i + vec_len_f32_avx512, v1_out);
+        }
+#elif defined(HAVE_AVX2)
+        auto attn_w_vec_fp32 = _mm256_set1_ps(weight * group_scale);
+        auto v_zp = _mm256_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx2 <= group_size; i += 2 * vec_len_f32_avx2) {
+            __m256 v0_value;
+            __m256 v1_value;
+            mm256_loadu_u4_to_f32(v_u4 + (offset + i) / 2, v0_value, v1_value);
+            auto v0_out = mm256_uni_loadu_ps(out + offset + i);
+            auto v1_out = mm256_uni_loadu_ps(out + offset + i + vec_len_f32_avx2);
+            v0_value = _mm256_sub_ps(v0_value, v_zp);
+            v1_value = _mm256_sub_ps(v1_value, v_zp);
+            v0_out = _mm256_fmadd_ps(attn_w_vec_fp32, v0_value, v0_out);
+            v1_out = _mm256_fmadd_ps(attn_w_vec_fp32, v1_value, v1_out);
+            mm256_uni_storeu_ps(out + offset + i, v0_out);
+            mm256_uni_storeu_ps(out + offset + i + vec_len_f32_avx2, v1_out);
+        }
+#endif
+        for (; i < group_size; i++) {
+            float value = extract_half_byte(v_u4[(offset + i) / 2], static_cast<bool>((offset + i) % 2));
+            out[offset + i] += weight * (value - group_zp) * group_scale;
+        }
+        group_id += 1;
+    }
+}
+
 template <typename T>
 void sum_q_head(T* a, size_t n, size_t group_size, float* out) {
     size_t group_id = 0;
@@ -1274,6 +1341,69 @@ static float dot_product(TA* a, uint8_t* b, size_t n, float* scale, float* zp, f
 #endif
 }
 
+template <typename TA>
+static float dot_product(TA* a,
+                         u4_pair* b,
+                         size_t n,
+                         float* scale,
+                         float* zp,
+                         [[maybe_unused]] float* head_sum,
+                         size_t group_size) {
+    auto* b_u4 = reinterpret_cast<uint8_t*>(b);
+    float sum = 0.0F;
+    size_t group_id = 0;
+    while (group_id < n / group_size) {
+        float group_scale = *(scale + group_id * 2);
+        float group_zp = *(zp + group_id * 2);
+        size_t offset = group_id * group_size;
+        size_t i = 0;
+        float group_sum = 0.0F;
+#if defined(HAVE_AVX512F)
+        auto vsum0 = _mm512_set1_ps(0.0F);
+        auto vsum1 = _mm512_set1_ps(0.0F);
+        auto v_zp = _mm512_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx512 <= group_size; i += 2 * vec_len_f32_avx512) {
+            auto va0 = mm512_uni_loadu_ps(a + offset + i);
+            auto va1 = mm512_uni_loadu_ps(a + offset + i + vec_len_f32_avx512);
+            __m512 vb0;
+            __m512 vb1;
+            mm512_loadu_u4_to_f32(b_u4 + (offset + i) / 2, vb0, vb1);
+            vb0 = _mm512_sub_ps(vb0, v_zp);
+            vb1 = _mm512_sub_ps(vb1, v_zp);
+            vsum0 = _mm512_fmadd_ps(va0, vb0, vsum0);
+            vsum1 = _mm512_fmadd_ps(va1, vb1, vsum1);
+        }
+        vsum0 = _mm512_add_ps(vsum0, vsum1);
+        group_sum = _mm512_reduce_add_ps(vsum0);
+#elif defined(HAVE_AVX2)
+        auto vsum0 = _mm256_set1_ps(0.0F);
+        auto vsum1 = _mm256_set1_ps(0.0F);
+        auto v_zp = _mm256_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx2 <= group_size; i += 2 * vec_len_f32_avx2) {
+            auto va0 = mm256_uni_loadu_ps(a + offset + i);
+            auto va1 = mm256_uni_loadu_ps(a + offset + i + vec_len_f32_avx2);
+            __m256 vb0;
+            __m256 vb1;
+            mm256_loadu_u4_to_f32(b_u4 + (offset + i) / 2, vb0, vb1);
+            vb0 = _mm256_sub_ps(vb0, v_zp);
+            vb1 = _mm256_sub_ps(vb1, v_zp);
+            vsum0 = _mm256_fmadd_ps(va0, vb0, vsum0);
+            vsum1 = _mm256_fmadd_ps(va1, vb1, vsum1);
+        }
+        vsum0 = _mm256_add_ps(vsum0, vsum1);
+        hsum(vsum0);
+        group_sum = _mm256_cvtss_f32(vsum0);
+#endif
+        for (; i < group_size; i++) {
+            float value = extract_half_byte(b_u4[(offset + i) / 2], static_cast<bool>((offset + i) % 2));
+            group_sum += a[offset + i] * (value - group_zp);
+        }
+        sum += group_scale * group_sum;
+        group_id += 1;
+    }
+    return sum;
+}
+
 template <typename T>
 static void attn_reduce(T* dst, float* temp, size_t M, size_t S, size_t temp_stride) {
     size_t i = 0;
@@ -1389,6 +1519,190 @@ static void attn_reduce(ov::float16* dst, ov::float16* temp, size_t M, size_t S,
 }
 #endif
 
+// the shortest context chunk of the split-KV decoding, shorter chunks don't pay off the merge of the partial results
+static constexpr size_t split_kv_min_chunk_len = 256;
+
+// returns the number of the context chunks of the split-KV decoding, 1 means that the context isn't split
+static size_t get_split_kv_chunk_num(size_t B, size_t h_group_num, size_t q_len, size_t kv_len, size_t nthr) {
+    if (q_len != 1 || B * h_group_num >= nthr) {
+        return 1;
+    }
+    return std::max<size_t>(1, std::min(intel_cpu::div_up(nthr, B * h_group_num), kv_len / split_kv_min_chunk_len));
+}
+
+// scales the scores of a context chunk, adds the attention mask to them and returns their maximum
+static float scale_mask_reduce_max(float* scores,
+                                   float d_scale,
+                                   const uint8_t* attn_mask,
+                                   ov::element::Type attn_mask_prec,
+                                   size_t len) {
+    float max = std::numeric_limits<float>::lowest();
+    if (!attn_mask) {
+        scale_add2_reduce_max<false, false, false, float>(scores,
+                                                          d_scale,
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          false,
+                                                          len,
+                                                          0,
+                                                          max);
+    } else if (attn_mask_prec == ov::element::f32) {
+        scale_add2_reduce_max<false, true, false>(scores,
+                                                  d_scale,
+                                                  nullptr,
+                                                  reinterpret_cast<const float*>(attn_mask),
+                                                  nullptr,
+                                                  false,
+                                                  len,
+                                                  0,
+                                                  max);
+    } else if (attn_mask_prec == ov::element::bf16) {
+        scale_add2_reduce_max<false, true, false>(scores,
+                                                  d_scale,
+                                                  nullptr,
+                                                  reinterpret_cast<const ov::bfloat16*>(attn_mask),
+                                                  nullptr,
+                                                  false,
+                                                  len,
+                                                  0,
+                                                  max);
+    } else {
+        scale_add2_reduce_max<false, true, false>(scores,
+                                                  d_scale,
+                                                  nullptr,
+                                                  reinterpret_cast<const ov::float16*>(attn_mask),
+                                                  nullptr,
+                                                  false,
+                                                  len,
+                                                  0,
+                                                  max);
+    }
+    return max;
+}
+
+// Flash decoding: when B * H_kv can't occupy all the threads, the context is split into chunks. Each chunk computes
+// the maximum of its scores, the sum of their exponents and the output weighted by the exponents in one pass, then
+// the partial outputs are merged by their log-sum-exp.
+template <typename T, typename T2>
+static void mha_single_token_split_kv_kernel(const ov::intel_cpu::PlainTensor& query,
+                                             const ov::intel_cpu::PlainTensor& present_key,
+                                             const ov::intel_cpu::PlainTensor& present_value,
+                                             const ov::intel_cpu::PlainTensor& attention_mask,
+                                             const ov::intel_cpu::PlainTensor& beams,
+                                             ov::intel_cpu::PlainTensor& output_emb,
+                                             ov::intel_cpu::PlainTensor& buf_attn_w,
+                                             ov::intel_cpu::PlainTensor& buf_attn_score,
+                                             bool has_out_transpose,
+                                             float d_scale,
+                                             const ov::intel_cpu::PlainTensor& past_k_scale_zp,
+                                             const ov::intel_cpu::PlainTensor& past_v_scale_zp,
+                                             ov::intel_cpu::PlainTensor& head_sum,
+                                             size_t key_group_size,
+                                             size_t value_group_size,
+                                             size_t chunk_num) {
+    auto B = query.size(0);
+    auto H = query.size(1);
+    auto S = query.size(3);
+    auto SV = present_value.size(3);
+    auto h_group_num = present_value.size(1);
+    auto h_each_group_len = H / h_group_num;
+    auto kv_len = present_key.size(2);
+    auto chunk_len = intel_cpu::div_up(kv_len, chunk_num);
+    auto attn_mask_prec = attention_mask.get_precision();
+    // partial result of a chunk: the maximum, the sum of the exponents and the output, aligned to the cache line
+    buf_attn_score.resize<float>({B, H, chunk_num, intel_cpu::rnd_up(SV + 2, 16)});
+
+    parallel_for3d(B, h_group_num, chunk_num, [&](size_t b, size_t h_group, size_t chunk) {
+        const size_t start = std::min(kv_len, chunk * chunk_len);
+        const size_t end = std::min(kv_len, start + chunk_len);
+        const size_t h_begin = h_group * h_each_group_len;
+        const size_t h_end = h_begin + h_each_group_len;
+        for (size_t pk = start; pk < end; pk++) {
+            auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+            auto* p = past_k_scale_zp.ptr<float>(pk, b_kv, h_group);
+            auto p_k = kv_cache_ptr<T2>(present_key, b_kv, h_group, pk);
+            for (size_t h = h_begin; h < h_end; h++) {
+                buf_attn_w.ptr<float>(b, h, 0)[pk] = dot_product(query.ptr<T>(b, h, 0),
+                                                                 p_k,
+                                                                 S,
+                                                                 p,
+                                                                 p + 1,
+                                                                 head_sum.ptr<float>(b, h, 0),
+                                                                 key_group_size);
+            }
+        }
+        for (size_t h = h_begin; h < h_end; h++) {
+            auto* partial = buf_attn_score.ptr<float>(b, h, chunk);
+            float max = std::numeric_limits<float>::lowest();
+            float sum = 0.0F;
+            if (start < end) {
+                uint8_t* attn_mask_ptr = nullptr;
+                if (attention_mask) {
+                    attn_mask_ptr = reinterpret_cast<uint8_t*>(&attention_mask.at<T>({b, h, 0, start}, true));
+                }
+                auto* scores = buf_attn_w.ptr<float>(b, h, 0) + start;
+                max = scale_mask_reduce_max(scores, d_scale, attn_mask_ptr, attn_mask_prec, end - start);
+                // the scores of the fully masked chunk are -inf, so the maximum doesn't exceed the initial one. The
+                // chunk has no weight, its zero sum makes the merge skip it
+                if (max <= std::numeric_limits<float>::lowest()) {
+                    std::fill(scores, scores + (end - start), 0.0F);
+                } else {
+                    exp_reduce_sum(scores, max, end - start, sum);
+                }
+            }
+            partial[0] = max;
+            partial[1] = sum;
+            std::memset(partial + 2, 0, SV * sizeof(float));
+        }
+        for (size_t pv = start; pv < end; pv++) {
+            auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
+            auto* v = kv_cache_ptr<T2>(present_value, b_kv, h_group, pv);
+            auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
+            for (size_t h = h_begin; h < h_end; h++) {
+                attn_acc_value(buf_attn_score.ptr<float>(b, h, chunk) + 2,
+                               buf_attn_w.ptr<float>(b, h, 0)[pv],
+                               v,
+                               SV,
+                               p + 0,
+                               p + 1,
+                               value_group_size);
+            }
+        }
+    });
+
+    parallel_for2d(B, H, [&](size_t b, size_t h) {
+        // the empty and the fully masked chunks have the zero sum and are skipped
+        float max = std::numeric_limits<float>::lowest();
+        for (size_t chunk = 0; chunk < chunk_num; chunk++) {
+            const auto* partial = buf_attn_score.ptr<float>(b, h, chunk);
+            if (partial[1] > 0.0F) {
+                max = std::max(max, partial[0]);
+            }
+        }
+        // the output of the first chunk accumulates the rescaled outputs of the others
+        auto* out = buf_attn_score.ptr<float>(b, h, 0);
+        float factor = out[1] > 0.0F ? std::exp(out[0] - max) : 0.0F;
+        float sum = out[1] * factor;
+        for (size_t i = 0; i < SV; i++) {
+            out[2 + i] *= factor;
+        }
+        for (size_t chunk = 1; chunk < chunk_num; chunk++) {
+            auto* partial = buf_attn_score.ptr<float>(b, h, chunk);
+            if (partial[1] == 0.0F) {
+                continue;
+            }
+            factor = std::exp(partial[0] - max);
+            sum += partial[1] * factor;
+            for (size_t i = 0; i < SV; i++) {
+                out[2 + i] += partial[2 + i] * factor;
+            }
+        }
+        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, 0, h * SV) : output_emb.ptr<T>(b, h, 0);
+        multiply_scalar(out + 2, dst, 1.0F / sum, SV);
+    });
+}
+
 template <typename T, typename T2, typename T3>
 static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                     const ov::intel_cpu::PlainTensor& present_key,
@@ -1434,7 +1748,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     // avx2 will pre-compute the zero point and try to save the sub instruction in the dot_product,
     //  but it seems not necessary for avx512. Possible reason may be that for avx2 the cost of dot_product
     //  is larger than the memory access time, but for avx512 is not and the cost of pre-compute is a pure increase.
-    if (pastkv_is_int8 && !quant_key_by_channel) {
+    if (pastkv_is_int8 && !quant_key_by_channel && std::is_same_v<T2, uint8_t>) {
         // be sure no false sharing
         size_t group_num = S / key_group_size;
         head_sum.resize<float>({B, H, q_len, group_num + 16});
@@ -1444,6 +1758,29 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     }
 #endif
 
+    if constexpr (std::is_same_v<T3, float>) {
+        auto chunk_num = get_split_kv_chunk_num(B, h_group_num, q_len, kv_len, static_cast<size_t>(nthr));
+        if (chunk_num > 1 && !alibi_mask && !quant_key_by_channel) {
+            mha_single_token_split_kv_kernel<T, T2>(query,
+                                                    present_key,
+                                                    present_value,
+                                                    attention_mask,
+                                                    beams,
+                                                    output_emb,
+                                                    buf_attn_w,
+                                                    buf_attn_score,
+                                                    has_out_transpose,
+                                                    d_scale,
+                                                    past_k_scale_zp,
+                                                    past_v_scale_zp,
+                                                    head_sum,
+                                                    key_group_size,
+                                                    value_group_size,
+                                                    chunk_num);
+            return;
+        }
+    }
+
     parallel_nt_static(nthr, [&](const size_t ithr, const size_t nthr) {
         size_t start{0};
         size_t end{0};
@@ -1483,7 +1820,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             buf_attn_w.ptr<T3>(0, h_group, 0)[pk] =
                                 dot_product_by_channel(query.ptr<T>(0, h_group), p_k, S, p_scale, p_zp, key_group_size);
                         } else {
-                            auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                            auto p_k = kv_cache_ptr<T2>(present_key, 0, h_group, pk);
                             prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                             buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = dot_product(query.ptr<T>(0, h_group),
                                                                                 p_k,
@@ -1521,7 +1858,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             buf_attn_w.ptr<T3>(b, h_group, 0)[pk] =
                                 dot_product_by_channel(query.ptr<T>(b, h_group), p_k, S, p_scale, p_zp, key_group_size);
                         } else {
-                            auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                            auto p_k = kv_cache_ptr<T2>(present_key, b_kv, h_group, pk);
                             buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = dot_product(query.ptr<T>(b, h_group),
                                                                                 p_k,
                                                                                 S,
@@ -1564,8 +1901,9 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                                                                           p_zp,
                                                                                           key_group_size);
                             } else {
+                                auto p_k = kv_cache_ptr<T2>(present_key, b_kv, h_group, pk);
                                 buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product(query.ptr<T>(b, h, pq),
-                                                                               present_key.ptr<T2>(b_kv, h_group, pk),
+                                                                               p_k,
                                                                                S,
                                                                                p,
                                                                                p + 1,
@@ -1613,7 +1951,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             memset(buf_attn_score.ptr<T3>(ithr), 0, q_len * h_each_group_len * SV * sizeof(T3));
             for (size_t pv = 0; pv < kv_len; pv++) {
                 auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                auto* v = kv_cache_ptr<T2>(present_value, b_kv, h_group, pv);
                 auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len;
@@ -1657,7 +1995,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             if (intel_cpu::all_of(1U, q_len, h_each_group_len)) {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = kv_cache_ptr<T2>(present_value, b_kv, h_group, pv);
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                     attn_acc_value(buf_attn_score.ptr<T3>(ithr, b, 0, h_group),
                                    buf_attn_w.ptr<T3>(b, h_group, 0, pv)[0],
@@ -1671,7 +2009,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             } else {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = kv_cache_ptr<T2>(present_value, b_kv, h_group, pv);
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                     for (size_t pq = 0; pq < q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
@@ -1740,6 +2078,25 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                   key_group_size,
                                                                   value_group_size,
                                                                   quant_key_by_channel);
+        } else if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<ov::bfloat16, u4_pair, float>(query,
+                                                                  present_key,
+                                                                  present_value,
+                                                                  alibi_mask,
+                                                                  attention_mask,
+                                                                  beams,
+                                                                  output_emb,
+                                                                  buf_attn_w,
+                                                                  buf_attn_score,
+                                                                  has_out_transpose,
+                                                                  auto_causal,
+                                                                  d_scale,
+                                                                  past_k_scale_zp,
+                                                                  past_v_scale_zp,
+                                                                  head_sum,
+                                                                  key_group_size,
+                                                                  value_group_size,
+                                                                  quant_key_by_channel);
         } else {
             mha_single_token_kernel<ov::bfloat16, ov::bfloat16, float>(query,
                                                                        present_key,
@@ -1804,6 +2161,25 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                  key_group_size,
                                                                  value_group_size,
                                                                  quant_key_by_channel);
+        } else if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<ov::float16, u4_pair, float>(query,
+                                                                 present_key,
+                                                                 present_value,
+                                                                 alibi_mask,
+                                                                 attention_mask,
+                                                                 beams,
+                                                                 output_emb,
+                                                                 buf_attn_w,
+                                                                 buf_attn_score,
+                                                                 has_out_transpose,
+                                                                 auto_causal,
+                                                                 d_scale,
+                                                                 past_k_scale_zp,
+                                                                 past_v_scale_zp,
+                                                                 head_sum,
+                                                                 key_group_size,
+                                                                 value_group_size,
+                                                                 quant_key_by_channel);
         } else {
             mha_single_token_kernel<ov::float16, ov::float16, float>(query,
                                                                      present_key,
@@ -1845,6 +2221,25 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                            key_group_size,
                                                            value_group_size,
                                                            quant_key_by_channel);
+        } else if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<float, u4_pair, float>(query,
+                                                           present_key,
+                                                           present_value,
+                                                           alibi_mask,
+                                                           attention_mask,
+                                                           beams,
+                                                           output_emb,
+                                                           buf_attn_w,
+                                                           buf_attn_score,
+                                                           has_out_transpose,
+                                                           auto_causal,
+                                                           d_scale,
+                                                           past_k_scale_zp,
+                                                           past_v_scale_zp,
+                                                           head_sum,
+                                                           key_group_size,
+                                                           value_group_size,
+                                                           quant_key_by_channel);
         } else if (present_key.get_precision() == ov::element::f16) {
             mha_single_token_kernel<float, ov::float16, float>(query,
                                                                present_key,
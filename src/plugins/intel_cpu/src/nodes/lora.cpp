@@ -68,7 +68,11 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
     graphInputConfig.emplace_back(node::Input::InputConfig{mainInputDesc, isInPlace});
 
     for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
+        auto desc = getParentOutputMemDesc(getParentEdgeAt(i));
+        // the adapter indices of the multi-adapter LoRA are gathered as is
+        if (i != ADAPTER_INDICES) {
+            desc = desc->cloneWithNewPrecision(mainInputPrc);
+        }
         inConfs.emplace_back(desc);
         graphInputConfig.emplace_back(node::Input::InputConfig{desc, isInPlace});
     }
@@ -39,6 +39,10 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    // optional input with per batch row indices of the stacked adapters, the inner graph gathers a copy of the
+    // adapter matrices for every row
+    static constexpr size_t ADAPTER_INDICES = 5;
+
     std::shared_ptr<const ov::Model> m_body;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
@@ -973,6 +973,8 @@ void MemoryInputSDPA::assignStateHook() {
     CPU_NODE_ASSERT(sdpaNode, "SDPA node is not available");
     auto sdpaState = std::dynamic_pointer_cast<VariableStateKVcache>(currentState);
     CPU_NODE_ASSERT(sdpaState, "Unexpected state type: ", currentState->get_name());
+    // the state paged out to a file is paged in before the inference
+    sdpaState->restore();
     sdpaNode->assignState(sdpaState, m_child_port_idx);
 }
 
@@ -996,7 +998,7 @@ MemStatePtr MemoryInputSDPA::makeState() const {
     CPU_NODE_ASSERT(node, "SDPA node is not available");
     auto kv_precision = node->getKVCachePrecision();
     ScaledDotProductAttention::SDPAQuantParam quant_param;
-    if (kv_precision == ov::element::u8) {
+    if (any_of(kv_precision, ov::element::u8, ov::element::u4)) {
         const auto& edges_to_past_key = node->getParentEdgeAt(node->getParentEdges().size() - 2);
         const auto& past_key = std::dynamic_pointer_cast<node::MemoryInputBase>(edges_to_past_key->getParent());
         OPENVINO_ASSERT(past_key);
@@ -1010,11 +1012,17 @@ MemStatePtr MemoryInputSDPA::makeState() const {
 
     auto internal_desc = ArbitraryOrderDescCreator(order).createSharedDesc(kv_precision, outputShapes.at(0));
 
-    return std::make_shared<VariableStateKVcache>(state_name,
-                                                  original_desc,
-                                                  internal_desc,
-                                                  quant_param.isByChannel,
-                                                  quant_param.groupSize);
+    auto offloadStatistics = context->getMemoryStatesRegister()->getOffloadedStatesStatistics();
+    auto state = std::make_shared<VariableStateKVcache>(state_name,
+                                                        original_desc,
+                                                        internal_desc,
+                                                        quant_param.isByChannel,
+                                                        quant_param.groupSize,
+                                                        std::move(offloadStatistics));
+    if (auto heads = node->getTensorParallelHeads()) {
+        state->assign_head_range(*heads);
+    }
+    return state;
 }
 
 void MemoryInputSDPA::runStatic(dnnl::stream strm) {
@@ -48,12 +48,17 @@ public:
         return memory_inputs;
     }
 
+    const OffloadedStatesStatisticsPtr& getOffloadedStatesStatistics() const {
+        return offloaded_states;
+    }
+
 private:
     MemoryInputBase* getMemoryInputByName(const std::string& name);
     MemoryOutputBase* getMemoryOutputByName(const std::string& name);
 
     InputNodesMap memory_inputs;
     OutputNodesMap memory_outputs;
+    OffloadedStatesStatisticsPtr offloaded_states = std::make_shared<OffloadedStatesStatistics>();
 };
 
 class MemoryOutputBase : public Node, public MemoryNode {
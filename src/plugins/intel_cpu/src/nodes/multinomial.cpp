@@ -4,6 +4,8 @@
 
 #include "multinomial.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
@@ -14,6 +16,8 @@
 #include <openvino/op/constant.hpp>
 #include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -27,6 +31,7 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/multinomial.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
 #include "utils/bfloat16.hpp"
 #include "utils/general_utils.h"
 
@@ -39,14 +44,23 @@ Multinomial::Multinomial(const std::shared_ptr<ov::Node>& op, const GraphContext
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
     }
 
-    auto multinomial_op = as_type_ptr<op::v13::Multinomial>(op);
-    m_with_replacement = multinomial_op->get_with_replacement();
-    m_global_seed = multinomial_op->get_global_seed();
-    m_log_probs = multinomial_op->get_log_probs();
-    m_op_seed = multinomial_op->get_op_seed();
+    if (const auto sampling_op = as_type_ptr<SamplingNode>(op)) {
+        m_fused_sampling = true;
+        m_with_row_ids = sampling_op->get_input_size() > ROW_IDS_PORT;
+        m_with_replacement = true;
+        m_global_seed = sampling_op->get_global_seed();
+        m_op_seed = sampling_op->get_op_seed();
+        m_output_precision = sampling_op->get_output_element_type(OUTPUT_PORT);
+    } else {
+        auto multinomial_op = as_type_ptr<op::v13::Multinomial>(op);
+        m_with_replacement = multinomial_op->get_with_replacement();
+        m_global_seed = multinomial_op->get_global_seed();
+        m_log_probs = multinomial_op->get_log_probs();
+        m_op_seed = multinomial_op->get_op_seed();
+        m_output_precision = multinomial_op->get_convert_type();
+    }
 
     m_num_samples_precision = ov::element::i32;
-    m_output_precision = multinomial_op->get_convert_type();
 
     constant = ConstantType::StrictNoConst;
 
@@ -57,7 +71,8 @@ Multinomial::Multinomial(const std::shared_ptr<ov::Node>& op, const GraphContext
 
 bool Multinomial::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (op->get_type_info() != op::v13::Multinomial::get_type_info_static()) {
+        if (op->get_type_info() != op::v13::Multinomial::get_type_info_static() &&
+            !ov::is_type<const SamplingNode>(op)) {
             errorMessage = "Only Multinomial operation from the opset13 is supported by the CPU plugin.";
             return false;
         }
@@ -68,7 +83,7 @@ bool Multinomial::isSupportedOperation(const std::shared_ptr<const ov::Node>& op
 }
 
 void Multinomial::getSupportedDescriptors() {
-    if (getParentEdges().size() != 2) {
+    if (getParentEdges().size() != (m_fused_sampling ? (m_with_row_ids ? 6 : 5) : 2)) {
         CPU_NODE_THROW("has incorrect number of input edges.");
     }
     if (getChildEdges().size() != 1) {
@@ -82,10 +97,19 @@ void Multinomial::initSupportedPrimitiveDescriptors() {
         m_probs_precision = ov::element::f32;
     }
 
-    addSupportedPrimDesc({{LayoutType::ncsp, m_probs_precision, m_const_inputs[PROBS_PORT]},
-                          {LayoutType::ncsp, m_num_samples_precision, m_const_inputs[NUM_SAMPLES_PORT]}},
-                         {{LayoutType::ncsp, m_output_precision}},
-                         ref_any);
+    std::vector<PortConfigurator> inPortConfigs{
+        {LayoutType::ncsp, m_probs_precision, m_const_inputs[PROBS_PORT]},
+        {LayoutType::ncsp, m_num_samples_precision, m_const_inputs[NUM_SAMPLES_PORT]}};
+    if (m_fused_sampling) {
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32);
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::i32);
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32);
+        if (m_with_row_ids) {
+            inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::i32);
+        }
+    }
+
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, m_output_precision}}, ref_any);
 }
 
 bool Multinomial::needShapeInfer() const {
@@ -132,6 +156,29 @@ void Multinomial::prepareParams() {
     m_input_elements_count = m_batches_count * m_probs_count;
     m_output_elements_count = m_batches_count * m_samples_count;
     m_batches_samples_probs_count = m_output_elements_count * m_probs_count;
+
+    if (m_fused_sampling) {
+        m_temperature_count = getSrcMemoryAtPort(TEMPERATURE_PORT)->getShape().getElementsCount();
+        m_top_k_count = getSrcMemoryAtPort(TOP_K_PORT)->getShape().getElementsCount();
+        m_top_p_count = getSrcMemoryAtPort(TOP_P_PORT)->getShape().getElementsCount();
+        for (const auto count : {m_temperature_count, m_top_k_count, m_top_p_count}) {
+            CPU_NODE_ASSERT(count == 1 || count == m_batches_count,
+                            "expects sampling parameters common or per batch row, but got ",
+                            count,
+                            " values for ",
+                            m_batches_count,
+                            " rows");
+        }
+        if (m_with_row_ids) {
+            const auto row_ids_count = getSrcMemoryAtPort(ROW_IDS_PORT)->getShape().getElementsCount();
+            CPU_NODE_ASSERT(row_ids_count == m_batches_count,
+                            "expects a row id per batch row, but got ",
+                            row_ids_count,
+                            " ids for ",
+                            m_batches_count,
+                            " rows");
+        }
+    }
 }
 
 bool Multinomial::neverExecute() const {
@@ -174,6 +221,9 @@ template <typename P>
 void Multinomial::execute_probs_type() {
     switch (m_output_precision) {
     case ov::element::i32:
+        if (m_fused_sampling) {
+            return execute_sampling<P, int32_t>();
+        }
         return execute_convert_type<P, int32_t>();
     default:
         CPU_NODE_THROW("Multinomial CPU implementation does not support output convert type: ", m_output_precision);
@@ -283,4 +333,111 @@ void Multinomial::execute_convert_type() {
     }
 }
 
+template <typename P, typename O>
+void Multinomial::execute_sampling() {
+    const auto* logits = getSrcDataAtPortAs<const P>(PROBS_PORT);
+    const auto* temperature = getSrcDataAtPortAs<const float>(TEMPERATURE_PORT);
+    const auto* top_k = getSrcDataAtPortAs<const int32_t>(TOP_K_PORT);
+    const auto* top_p = getSrcDataAtPortAs<const float>(TOP_P_PORT);
+    auto* output = getDstDataAtPortAs<O>(OUTPUT_PORT);
+
+    const auto* row_ids = m_with_row_ids ? getSrcDataAtPortAs<const int32_t>(ROW_IDS_PORT) : nullptr;
+    const uint64_t global_seed =
+        all_of(0U, m_global_seed, m_op_seed) ? static_cast<uint64_t>(std::time(nullptr)) : m_global_seed;
+    const auto gen_max = static_cast<float>(std::mt19937::max());
+
+    // the candidates are ordered as the sorted TopK outputs: the larger logit first, the smaller index among equal ones
+    const auto greater = [](const std::pair<float, int32_t>& lhs, const std::pair<float, int32_t>& rhs) {
+        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+    };
+
+    parallel_for(m_batches_count, [&](size_t idx_batch) {
+        const auto* row = logits + idx_batch * m_probs_count;
+        auto* row_output = output + idx_batch * m_samples_count;
+        const float row_temperature = temperature[m_temperature_count == 1 ? 0 : idx_batch];
+        const float row_top_p = top_p[m_top_p_count == 1 ? 0 : idx_batch];
+        auto row_top_k = static_cast<size_t>(std::max(top_k[m_top_k_count == 1 ? 0 : idx_batch], 0));
+        if (row_top_k == 0 || row_top_k > m_probs_count) {
+            row_top_k = m_probs_count;
+        }
+
+        // zero temperature means greedy sampling
+        if (row_temperature == 0.0F) {
+            size_t idx_max = 0;
+            for (size_t idx_prob = 1; idx_prob < m_probs_count; ++idx_prob) {
+                if (static_cast<float>(row[idx_prob]) > static_cast<float>(row[idx_max])) {
+                    idx_max = idx_prob;
+                }
+            }
+            std::fill(row_output, row_output + m_samples_count, static_cast<O>(idx_max));
+            return;
+        }
+
+        // the candidates are needed in the descending order only if the distribution is truncated,
+        // the top-k ones are selected in a single pass keeping the k largest logits in a min-heap
+        const bool truncated = row_top_k < m_probs_count || row_top_p < 1.0F;
+        std::vector<std::pair<float, int32_t>> candidates;
+        if (row_top_k < m_probs_count) {
+            candidates.reserve(row_top_k);
+            for (size_t idx_prob = 0; idx_prob < m_probs_count; ++idx_prob) {
+                const auto value = static_cast<float>(row[idx_prob]);
+                if (candidates.size() < row_top_k) {
+                    candidates.emplace_back(value, static_cast<int32_t>(idx_prob));
+                    std::push_heap(candidates.begin(), candidates.end(), greater);
+                } else if (value > candidates.front().first) {
+                    std::pop_heap(candidates.begin(), candidates.end(), greater);
+                    candidates.back() = {value, static_cast<int32_t>(idx_prob)};
+                    std::push_heap(candidates.begin(), candidates.end(), greater);
+                }
+            }
+            std::sort_heap(candidates.begin(), candidates.end(), greater);
+        } else if (truncated) {
+            candidates.resize(m_probs_count);
+            for (size_t idx_prob = 0; idx_prob < m_probs_count; ++idx_prob) {
+                candidates[idx_prob] = {static_cast<float>(row[idx_prob]), static_cast<int32_t>(idx_prob)};
+            }
+            std::sort(candidates.begin(), candidates.end(), greater);
+        }
+
+        const size_t candidates_count = truncated ? candidates.size() : m_probs_count;
+        const float inv_temperature = 1.0F / row_temperature;
+        auto scaled_value = [&](size_t idx) {
+            return (truncated ? candidates[idx].first : static_cast<float>(row[idx])) * inv_temperature;
+        };
+
+        // softmax of the scaled logits & cumsum
+        float max_value = scaled_value(0);
+        for (size_t idx = 1; idx < candidates_count; ++idx) {
+            max_value = std::max(max_value, scaled_value(idx));
+        }
+        std::vector<float> cdf(candidates_count);
+        float sum = 0.0F;
+        for (size_t idx = 0; idx < candidates_count; ++idx) {
+            sum += std::exp(scaled_value(idx) - max_value);
+            cdf[idx] = sum;
+        }
+
+        // top-p keeps the candidates, whose preceding probability mass is less than top_p
+        size_t kept_count = candidates_count;
+        if (row_top_p < 1.0F) {
+            const auto threshold = std::max(row_top_p, 0.0F) * sum;
+            const auto it = std::lower_bound(cdf.begin(), cdf.end(), threshold);
+            kept_count = std::min(static_cast<size_t>(std::distance(cdf.begin(), it)) + 1, candidates_count);
+        }
+        const float kept_sum = cdf[kept_count - 1];
+
+        // every row has its own generator, so the samples of a sequence do not depend on the other rows of the batch
+        const auto row_id = row_ids ? static_cast<uint64_t>(row_ids[idx_batch]) : static_cast<uint64_t>(idx_batch);
+        std::seed_seq seed{global_seed, m_op_seed, row_id};
+        std::mt19937 gen(seed);
+        for (size_t idx_sample = 0; idx_sample < m_samples_count; ++idx_sample) {
+            const auto random_sample = static_cast<float>(static_cast<P>(static_cast<float>(gen()) / gen_max));
+            const float sample_value = random_sample * kept_sum;
+            const auto it = std::lower_bound(cdf.begin(), cdf.begin() + kept_count, sample_value);
+            const auto idx = std::min(static_cast<size_t>(std::distance(cdf.begin(), it)), kept_count - 1);
+            row_output[idx_sample] = static_cast<O>(truncated ? candidates[idx].second : idx);
+        }
+    });
+}
+
 }  // namespace ov::intel_cpu::node
@@ -47,6 +47,8 @@ protected:
 
 private:
     /// Multinomial params
+    bool m_fused_sampling = false;  // sampling from logits with temperature, top-k and top-p
+    bool m_with_row_ids = false;    // the fused sampling seeds the generator of each row by the given row id
     bool m_with_replacement = false;
     bool m_log_probs = false;
     uint64_t m_global_seed = 0;
@@ -55,6 +57,10 @@ private:
     /// Shape inference
     static constexpr size_t PROBS_PORT = 0LU;
     static constexpr size_t NUM_SAMPLES_PORT = 1LU;
+    static constexpr size_t TEMPERATURE_PORT = 2LU;
+    static constexpr size_t TOP_K_PORT = 3LU;
+    static constexpr size_t TOP_P_PORT = 4LU;
+    static constexpr size_t ROW_IDS_PORT = 5LU;
     static constexpr size_t OUTPUT_PORT = 0LU;
     bool m_const_inputs[2] = {false, false};
     bool m_const_batch = false;
@@ -73,11 +79,19 @@ private:
     size_t m_output_elements_count = 0;
     size_t m_batches_samples_probs_count = 0;
 
+    /// Fused sampling parameters are either common or given per batch row
+    size_t m_temperature_count = 0;
+    size_t m_top_k_count = 0;
+    size_t m_top_p_count = 0;
+
     template <typename P>
     void execute_probs_type();
 
     template <typename P, typename O>
     void execute_convert_type();
+
+    template <typename P, typename O>
+    void execute_sampling();
 };
 
 }  // namespace ov::intel_cpu::node
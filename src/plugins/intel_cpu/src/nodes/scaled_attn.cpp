@@ -14,7 +14,9 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 
+#include "common/cpu_memcpy.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu_memory.h"
 #include "dnnl_extension_utils.h"
@@ -34,6 +36,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/scaled_dot_product_attention.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_message.hpp"
 #include "shape_inference/custom/scaled_attn.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
 #include "utils/general_utils.h"
@@ -1073,6 +1076,19 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             k_input.assert_dims({B, Hk, L0 + L1, S});
             v_input.assert_dims({B, Hk, L0 + L1, SV});
         }
+        // tensor parallel: only the heads of the sub-stream are computed, the KV cache states keep only these heads
+        const bool split_heads = config.kv_head_end > config.kv_head_begin;
+        const size_t group_size = q_input.size(1) / Hk;
+        if (split_heads) {
+            q_input = q_input.slice(1, config.kv_head_begin * group_size, config.kv_head_end * group_size);
+            k_input = k_input.slice(1, config.kv_head_begin, config.kv_head_end);
+            v_input = v_input.slice(1, config.kv_head_begin, config.kv_head_end);
+            if (!fuse_concat) {
+                present_key = present_key.slice(1, config.kv_head_begin, config.kv_head_end);
+                present_value = present_value.slice(1, config.kv_head_begin, config.kv_head_end);
+            }
+            Hk = k_input.size(1);
+        }
         present_key.assert_dims({B, Hk, L0 + L1, S});
         present_value.assert_dims({B, Hk, L0 + L1, SV});
         if (beam_table) {
@@ -1109,6 +1125,9 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
                 }
             }
         }
+        if (split_heads && use_attn_mask && attn_mask.size(1) > 1) {
+            attn_mask = attn_mask.slice(1, config.kv_head_begin * group_size, config.kv_head_end * group_size);
+        }
 
         // second token, or first token with pastkv fusing
         bool use_one_token = L1 == 1 || (fuse_concat && L0 > 0);
@@ -1153,6 +1172,7 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     if (!isSupportedOperation(op, errorMessage)) {
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
     }
+    initTensorParallelConfig(context);
     const auto& cpuConfig = context->getConfig();
     const auto& keyCachePrecision = cpuConfig.keyCachePrecision;
     const auto& valueCachePrecision = cpuConfig.valueCachePrecision;
@@ -1161,8 +1181,13 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     const auto keyS = *(keyDims.end() - 1);
     const auto valueS = *(valueDims.end() - 1);
     CPU_NODE_ASSERT(valueCachePrecision == keyCachePrecision, "supports same key/value cache precision");
-    CPU_NODE_ASSERT(any_of(keyCachePrecision, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8),
-                    "supports key/value cache precision f32, f16, bf16, u8 but gets ",
+    CPU_NODE_ASSERT(any_of(keyCachePrecision,
+                           ov::element::f32,
+                           ov::element::f16,
+                           ov::element::bf16,
+                           ov::element::u8,
+                           ov::element::u4),
+                    "supports key/value cache precision f32, f16, bf16, u8, u4 but gets ",
                     keyCachePrecision);
     m_key_quant_param.groupSize = (cpuConfig.keyCacheGroupSize == 0 || keyS % cpuConfig.keyCacheGroupSize != 0)
                                       ? keyS
@@ -1182,6 +1207,115 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     }
 }
 
+void ScaledDotProductAttention::initTensorParallelConfig(const GraphContext::CPtr& context) {
+    if (context->getCPUStreamExecutor()) {
+        if (!context->getCPUStreamExecutor()->get_rank().empty()) {
+            tp_cfg.w_rank = context->getCPUStreamExecutor()->get_rank()[0];
+            tp_cfg.w_size = ov::threading::message_manager()->get_num_sub_streams();
+            tp_cfg.enable_tensor_parallel = tp_cfg.w_size > 1;
+            tp_cfg.sub_memory = context->getSubMemory();
+        }
+    }
+}
+
+// The key/value heads are split between the sub-streams, the query heads of a group follow their key/value head.
+// Tensor parallel is disabled if the number of the heads is unknown or less than the number of the sub-streams.
+void ScaledDotProductAttention::initTensorParallelHeads() {
+    if (!tp_cfg.enable_tensor_parallel) {
+        return;
+    }
+    size_t Hq = Shape::UNDEFINED_DIM;
+    size_t Hk = Shape::UNDEFINED_DIM;
+    if (m_config.config.input_BLHxS) {
+        Hq = Hk = m_config.config.order_HS[0];
+    } else {
+        const auto& queryDims = getInputShapeAtPort(0).getDims();
+        const auto& keyDims = getInputShapeAtPort(1).getDims();
+        const size_t headAxis = m_config.config.permute_axes.empty() ? 1 : m_config.config.permute_axes[1];
+        if (queryDims.size() == 4 && keyDims.size() == 4) {
+            Hq = queryDims[headAxis];
+            Hk = keyDims[headAxis];
+        }
+    }
+    if (any_of(Shape::UNDEFINED_DIM, Hq, Hk) || Hk < static_cast<size_t>(tp_cfg.w_size) || Hq % Hk != 0) {
+        tp_cfg.enable_tensor_parallel = false;
+        return;
+    }
+    const size_t average = Hk / tp_cfg.w_size;
+    tp_cfg.kv_head_offsets.resize(tp_cfg.w_size + 1);
+    for (int i = 0; i < tp_cfg.w_size; i++) {
+        tp_cfg.kv_head_offsets[i] = i * average;
+    }
+    tp_cfg.kv_head_offsets.back() = Hk;
+    tp_cfg.group_size = Hq / Hk;
+    m_config.kv_head_begin = tp_cfg.kv_head_offsets[tp_cfg.w_rank];
+    m_config.kv_head_end = tp_cfg.kv_head_offsets[tp_cfg.w_rank + 1];
+}
+
+std::optional<VariableStateKVcache::HeadRange> ScaledDotProductAttention::getTensorParallelHeads() const {
+    if (!tp_cfg.enable_tensor_parallel) {
+        return std::nullopt;
+    }
+    return VariableStateKVcache::HeadRange{m_config.kv_head_begin, m_config.kv_head_end, tp_cfg.kv_head_offsets.back()};
+}
+
+PlainTensor ScaledDotProductAttention::sliceTensorParallelHeads(const PlainTensor& cur) const {
+    if (!tp_cfg.enable_tensor_parallel) {
+        return cur;
+    }
+    return cur.slice(1, m_config.kv_head_begin, m_config.kv_head_end);
+}
+
+// The sub-stream computes its heads into the local buffer, which is gathered into the output by all the sub-streams.
+MemoryPtr ScaledDotProductAttention::prepareTensorParallelDst() {
+    auto dst = getDstMemoryAtPort(0);
+    if (!tp_cfg.enable_tensor_parallel) {
+        return dst;
+    }
+    auto dims = dst->getStaticDims();
+    const size_t heads = (m_config.kv_head_end - m_config.kv_head_begin) * tp_cfg.group_size;
+    if (m_config.config.output_BLHxS) {
+        // [B, L1, H * SV]
+        dims[2] = dims[2] / (tp_cfg.kv_head_offsets.back() * tp_cfg.group_size) * heads;
+    } else {
+        // [B, H, L1, SV]
+        dims[1] = heads;
+    }
+    auto desc = dst->getDescPtr()->cloneWithNewDims(dims, true);
+    if (tp_cfg.cached_dst) {
+        tp_cfg.cached_dst->redefineDesc(desc);
+    } else {
+        tp_cfg.cached_dst = std::make_shared<Memory>(getEngine(), desc);
+    }
+    return tp_cfg.cached_dst;
+}
+
+void ScaledDotProductAttention::execTensorParallelSync() {
+    if (!tp_cfg.enable_tensor_parallel) {
+        return;
+    }
+    auto dst = getDstMemoryAtPort(0);
+    auto* dst_ptr = dst->getDataAs<uint8_t>();
+    const auto& dims = dst->getStaticDims();
+    const size_t H = tp_cfg.kv_head_offsets.back() * tp_cfg.group_size;
+    // the heads are contiguous in [B, H, L1 * SV] and [B * L1, H, SV]
+    const size_t outer = m_config.config.output_BLHxS ? dims[0] * dims[1] : dims[0];
+    const size_t head_size = outer * H == 0 ? 0 : dst->getSize() / (outer * H);
+
+    tp_cfg.sub_memory->share_memory(tp_cfg.id, tp_cfg.w_rank, tp_cfg.cached_dst->getData());
+    tp_cfg.sub_memory->for_each_shared_memory(tp_cfg.id, [&](int idx, void* send_buf) {
+        const auto* src_ptr = static_cast<const uint8_t*>(send_buf);
+        const size_t head_begin = tp_cfg.kv_head_offsets[idx] * tp_cfg.group_size;
+        const size_t heads = tp_cfg.kv_head_offsets[idx + 1] * tp_cfg.group_size - head_begin;
+        parallel_for2d(outer, heads, [&](size_t i, size_t h) {
+            cpu_memcpy(dst_ptr + (i * H + head_begin + h) * head_size,
+                       src_ptr + (i * heads + h) * head_size,
+                       head_size);
+        });
+    });
+    tp_cfg.sub_memory->release_memory(tp_cfg.id);
+}
+
 void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty()) {
         return;
@@ -1260,6 +1394,7 @@ void ScaledDotProductAttention::createPrimitive() {
         auto* desc = getSelectedPrimitiveDescriptor();
         CPU_NODE_ASSERT(desc, "has unidentified preferable primitive descriptor");
     }
+    initTensorParallelHeads();
     auto rtPrecision = getRuntimePrecision();
     const auto keyDims = getInputShapeAtPort(1).getDims();
     const auto valueDims = getInputShapeAtPort(2).getDims();
@@ -1282,6 +1417,14 @@ void ScaledDotProductAttention::createPrimitive() {
     OPENVINO_ASSERT(valueS % m_value_quant_param.groupSize == 0,
                     "ScaledDotProductAttention AttentionExecutor creation fails value state " + std::to_string(keyS) +
                         " cannot be divided by group size " + std::to_string(m_key_quant_param.groupSize));
+    if (getKVCachePrecision() == ov::element::u4) {
+        // the u4 cache is quantized by token, each group starts at a byte boundary
+        CPU_NODE_ASSERT(cpuConfig.keyCacheQuantMode != ov::intel_cpu::Config::CacheQuantMode::BY_CHANNEL,
+                        "doesn't support u4 key cache quantized by channel");
+        m_key_quant_param.isByChannel = false;
+        CPU_NODE_ASSERT(m_key_quant_param.groupSize % 2 == 0 && m_value_quant_param.groupSize % 2 == 0,
+                        "supports only even group sizes of u4 key/value cache");
+    }
     ScaledDotProductAttentionKey key = {rtPrecision};
 
     auto builder = [&]([[maybe_unused]] const ScaledDotProductAttentionKey& key) -> std::shared_ptr<Executor> {
@@ -1362,7 +1505,11 @@ void ScaledDotProductAttention::createPrimitive() {
 void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0);
     std::vector<MemoryPtr> inputs(orginSDPInputNumber);
-    auto output = getDstMemoryAtPort(0);
+    if (tp_cfg.enable_tensor_parallel) {
+        tp_cfg.id = tp_cfg.sub_memory->acquire_memory(tp_cfg.w_rank);
+        CPU_NODE_ASSERT(tp_cfg.id >= 0, "Tensor Parallel Config ID cannot be negative.");
+    }
+    auto output = prepareTensorParallelDst();
     MemoryPtr presentk_input;
     MemoryPtr presentv_input;
     MemoryPtr beam_input;
@@ -1388,6 +1535,7 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     }
     m_executor
         ->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp);
+    execTensorParallelSync();
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
@@ -1490,8 +1638,8 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
     PlainTensor cur_v;
     cur_k.reset(mem_cur_k);
     cur_v.reset(mem_cur_v);
-    cur_k = cur_k.permute(order);
-    cur_v = cur_v.permute(order);
+    cur_k = sliceTensorParallelHeads(cur_k.permute(order));
+    cur_v = sliceTensorParallelHeads(cur_v.permute(order));
     auto B = cur_k.size(0);
     auto H = cur_k.size(1);
     auto L1 = cur_k.size(2);
@@ -1554,15 +1702,16 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
                 auto idx = static_cast<size_t>(table[b]);
                 auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
-                memcpy(&new_pastk.at<char>({b, h, m}),
-                       &old_past_k.at<char>({b_kv, h, m}),
-                       S * old_past_k.m_element_size);
-                memcpy(&new_pastv.at<char>({b, h, m}),
-                       &old_past_v.at<char>({b_kv, h, m}),
-                       SV * old_past_v.m_element_size);
+                // the u4 cache packs two values into a byte
+                memcpy(new_pastk.ptr_v(b, h, m),
+                       old_past_k.ptr_v(b_kv, h, m),
+                       S * old_past_k.m_element_size / old_past_k.m_sub_byte_multiplier);
+                memcpy(new_pastv.ptr_v(b, h, m),
+                       old_past_v.ptr_v(b_kv, h, m),
+                       SV * old_past_v.m_element_size / old_past_v.m_sub_byte_multiplier);
             });
         }
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k;
@@ -1643,7 +1792,7 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                             VectorDims{},
                                                             strides);
         new_internal_mem_v->redefineDesc(mem_desc_v);
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             // past_k's shape is BHLS, internal layout LBHS
             // scale_zp's shape is LBHS, internal layout LBHS
             auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
@@ -1887,8 +2036,8 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     PlainTensor past_v;
     cur_k.reset(mem_cur_k);
     cur_v.reset(mem_cur_v);
-    cur_k = cur_k.permute(order);
-    cur_v = cur_v.permute(order);
+    cur_k = sliceTensorParallelHeads(cur_k.permute(order));
+    cur_v = sliceTensorParallelHeads(cur_v.permute(order));
     auto B = cur_k.size(0);
     auto H = cur_k.size(1);
     auto L1 = cur_k.size(2);
@@ -1950,7 +2099,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         m_v_state->assign_internal_state(new_internal_mem_v);
         m_k_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * S);
         m_v_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * SV);
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k;
@@ -2020,7 +2169,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         };
         internal_mem_k->redefineDesc(reset_desc(S));
         internal_mem_v->redefineDesc(reset_desc(SV));
-        if (kvcache_precision == ov::element::u8) {
+        if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             // only dim0, dim1 need change
@@ -2071,9 +2220,10 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             PlainTensor init_v;
             init_k.reset(k_mem);
             init_v.reset(v_mem);
-            init_k = init_k.permute(order);
-            init_v = init_v.permute(order);
-            if (kvcache_precision == ov::element::u8) {
+            // the initializer holds all the heads, while the past key/value of the sub-stream holds only its heads
+            init_k = sliceTensorParallelHeads(init_k.permute(order));
+            init_v = sliceTensorParallelHeads(init_v.permute(order));
+            if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
                 auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
                     ov::element::f32,
                     ov::intel_cpu::Shape{static_cast<size_t>(parallel_get_max_threads()),
@@ -2098,7 +2248,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         }
     }
 
-    if (kvcache_precision == ov::element::u8) {
+    if (any_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
         // past_k's shape is BHLS, internal layout LBHS
         // scale_zp's shape is LBHS, internal layout LBHS
         auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
@@ -2133,8 +2283,11 @@ ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
                              (all_of(ov::element::f16, keyCachePrecisionHint, valueCachePrecisionHint));
     kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     bool use_int8_kv_cache_precision = (all_of(ov::element::u8, keyCachePrecisionHint, valueCachePrecisionHint));
+    bool use_int4_kv_cache_precision = (all_of(ov::element::u4, keyCachePrecisionHint, valueCachePrecisionHint));
     if (use_int8_kv_cache_precision) {
         kvcache_precision = ov::element::u8;
+    } else if (use_int4_kv_cache_precision) {
+        kvcache_precision = ov::element::u4;
     } else {
         kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     }
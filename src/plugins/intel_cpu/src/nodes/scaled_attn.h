@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -18,11 +19,25 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "sub_memory_manager.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
 #include "utils/plain_tensor.hpp"
 
 namespace ov::intel_cpu::node {
 
+struct SDPATensorParallelConfig {
+    int w_rank = -1;
+    int w_size = -1;
+    int id = 0;
+    bool enable_tensor_parallel = false;
+    std::shared_ptr<SubMemoryManager> sub_memory = nullptr;
+    // the first key/value head of every sub-stream, the last item is the number of the key/value heads
+    std::vector<size_t> kv_head_offsets;
+    // the number of the query heads per key/value head
+    size_t group_size = 1;
+    MemoryPtr cached_dst = nullptr;
+};
+
 class ScaledDotProductAttention : public Node {
 public:
     ScaledDotProductAttention(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
@@ -55,6 +70,8 @@ public:
     enum KernelTypes : uint8_t { KT_REF, KT_ONEDNN, KT_MLAS, KT_ACL };
 
     void assignState(const std::shared_ptr<VariableStateKVcache>& state, int idx);
+    // the key/value heads held by the states of this sub-stream, if the heads are split between the sub-streams
+    std::optional<VariableStateKVcache::HeadRange> getTensorParallelHeads() const;
 
     std::vector<size_t> getKVCacheOrder() const {
         const auto& permute_axes = m_config.config.permute_axes;
@@ -79,9 +96,17 @@ private:
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
+    void initTensorParallelConfig(const GraphContext::CPtr& context);
+    void initTensorParallelHeads();
+    PlainTensor sliceTensorParallelHeads(const PlainTensor& cur) const;
+    MemoryPtr prepareTensorParallelDst();
+    void execTensorParallelSync();
 
     struct Config {
         ScaledDotProductAttentionWithKVCache::Config config;
+        // the range of the key/value heads computed by the node, all the heads are computed if the range is empty
+        size_t kv_head_begin = 0;
+        size_t kv_head_end = 0;
     };
 
     struct Executor {
@@ -112,6 +137,8 @@ private:
     std::vector<size_t> m_kvstate_layout = {2, 0, 1, 3};
     SDPAQuantParam m_key_quant_param;
     SDPAQuantParam m_value_quant_param;
+    // the heads and the KV cache states are split between the sub-streams of tensor parallel
+    SDPATensorParallelConfig tp_cfg;
 };
 
 }  // namespace ov::intel_cpu::node
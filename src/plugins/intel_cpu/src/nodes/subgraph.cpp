@@ -184,6 +184,9 @@ struct SubgraphShapeInferResultKey {
 struct SubgraphShapeInferResult {
     explicit SubgraphShapeInferResult(IShapeInfer::Result res) : result(std::move(res)) {}
 
+    // the result is never modified, so it may be shared between the streams
+    static constexpr bool threadSafeCacheValue = true;
+
     IShapeInfer::Result result;
 };
 
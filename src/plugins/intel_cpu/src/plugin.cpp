@@ -4,11 +4,13 @@
 
 #include "plugin.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <fstream>
 #include <istream>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -403,6 +405,25 @@ void Plugin::set_property(const ov::AnyMap& config) {
     engConfig.readProperties(config);
 }
 
+std::shared_ptr<ov::threading::IStreamsExecutor> Plugin::get_priority_streams_executor(
+    const ov::threading::IStreamsExecutor::Config& config) const {
+    std::lock_guard<std::mutex> lock(m_priority_executors_mutex);
+    m_priority_executors.erase(std::remove_if(m_priority_executors.begin(),
+                                              m_priority_executors.end(),
+                                              [](const auto& item) {
+                                                  return item.second.expired();
+                                              }),
+                               m_priority_executors.end());
+    for (auto& [executorConfig, executor] : m_priority_executors) {
+        if (auto sharedExecutor = executor.lock(); sharedExecutor && executorConfig == config) {
+            return sharedExecutor;
+        }
+    }
+    auto executor = get_executor_manager()->get_idle_cpu_streams_executor(config);
+    m_priority_executors.emplace_back(config, executor);
+    return executor;
+}
+
 ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options) const {
     if (name == ov::optimal_number_of_infer_requests) {
         const auto streams = engConfig.streamExecutorConfig.get_streams();
@@ -443,6 +464,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         const auto core_type = engConfig.schedulingCoreType;
         return core_type;
     }
+    if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
+    }
     if (name == ov::hint::model_distribution_policy) {
         const auto& distribution_policy = engConfig.modelDistributionPolicy;
         return distribution_policy;
@@ -546,6 +570,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             RW_property(ov::hint::enable_cpu_pinning.name()),
             RW_property(ov::hint::enable_cpu_reservation.name()),
             RW_property(ov::hint::scheduling_core_type.name()),
+            RW_property(ov::hint::model_priority.name()),
             RW_property(ov::hint::model_distribution_policy.name()),
             RW_property(ov::hint::enable_hyper_threading.name()),
             RW_property(ov::device::id.name()),
@@ -750,6 +775,10 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
     Config conf = engConfig;
     Config::ModelType modelType = getModelType(model);
     conf.applyRtInfo(model);
+    // the flag is trusted only in the blobs written by the plugin serializer, never in the user models
+    if (model->has_rt_info({"intel_cpu", "constants_verified"})) {
+        conf.constantsVerified = model->get_rt_info<bool>({"intel_cpu", "constants_verified"});
+    }
     // check ov::loaded_from_cache property and erase it to avoid exception in readProperties.
     const auto& it = _config.find(ov::loaded_from_cache.name());
     bool loaded_from_cache = false;
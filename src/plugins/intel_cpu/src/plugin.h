@@ -6,7 +6,10 @@
 
 #include <istream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "config.h"
 #include "openvino/core/any.hpp"
@@ -18,6 +21,7 @@
 #include "openvino/runtime/iremote_context.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
 #include "utils/serialize.hpp"
 
 namespace ov::intel_cpu {
@@ -62,6 +66,14 @@ public:
         OPENVINO_THROW_NOT_IMPLEMENTED("get_default_context is not supported by CPU plugin!");
     };
 
+    /**
+     * @brief Returns the streams executor of the models compiled with an explicit ov::hint::model_priority. The models
+     * with the same streams configuration share the executor, so the requests of all of them are ordered by priority
+     * in one queue.
+     */
+    std::shared_ptr<ov::threading::IStreamsExecutor> get_priority_streams_executor(
+        const ov::threading::IStreamsExecutor::Config& config) const;
+
     std::shared_ptr<ov::threading::MessageManager> m_msg_manager;
 
 private:
@@ -80,6 +92,11 @@ private:
     ov::AnyMap m_compiled_model_runtime_properties;
 
     std::shared_ptr<void> specialSetup;
+
+    mutable std::mutex m_priority_executors_mutex;
+    mutable std::vector<
+        std::pair<ov::threading::IStreamsExecutor::Config, std::weak_ptr<ov::threading::IStreamsExecutor>>>
+        m_priority_executors;
 };
 
 }  // namespace ov::intel_cpu
@@ -0,0 +1,465 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_weights_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "utils/sha256.hpp"
+
+#if !defined(_WIN32)
+#    include <fcntl.h>
+#    include <signal.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov::intel_cpu {
+
+#if !defined(_WIN32)
+
+namespace {
+
+constexpr std::array<char, 8> recordMagic{'O', 'V', 'C', 'P', 'U', 'W', 'G', 'T'};
+// to be incremented on any change of the record layout
+constexpr uint32_t recordVersion = 2;
+// the data offset keeps the weights aligned as the plugin allocator does
+constexpr size_t dataOffset = 64;
+// the record may be removed by its last user right between being opened and locked by another process
+constexpr size_t maxAttempts = 4;
+// the persistent records are not released with the processes, so they are bounded by a fixed size unless the size is
+// given explicitly, e.g. a tmpfs mount holds them in the host memory
+constexpr uint64_t defaultMaxSize = 4ULL << 30;
+
+struct RecordHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint64_t dataSize;
+    uint64_t dataHash;
+    // binds the record content to the key, which holds the digest of the source weights
+    Sha256::Digest keyDigest;
+};
+
+static_assert(sizeof(RecordHeader) <= dataOffset);
+
+// detects the corrupted or truncated records, processes four independent 64-bit lanes to keep up with the memory
+// bandwidth
+uint64_t hashData(const void* data, size_t size) {
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    auto round = [](uint64_t acc, uint64_t value) {
+        acc += value * prime2;
+        acc = (acc << 31) | (acc >> 33);
+        return acc * prime1;
+    };
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    std::array<uint64_t, 4> lanes{prime1, prime2, 0, static_cast<uint64_t>(size)};
+    size_t offset = 0;
+    for (; offset + sizeof(lanes) <= size; offset += sizeof(lanes)) {
+        for (size_t lane = 0; lane < lanes.size(); ++lane) {
+            uint64_t value = 0;
+            std::memcpy(&value, bytes + offset + lane * sizeof(value), sizeof(value));
+            lanes[lane] = round(lanes[lane], value);
+        }
+    }
+    uint64_t result = 0;
+    for (const auto lane : lanes) {
+        result = round(result ^ lane, size);
+    }
+    for (; offset < size; ++offset) {
+        result = round(result, bytes[offset]);
+    }
+    return result;
+}
+
+// the records are trusted only if they have been written by the same user and cannot be modified by the others
+bool isTrusted(const struct stat& fileStat) {
+    return fileStat.st_uid == geteuid() && S_ISREG(fileStat.st_mode) && (fileStat.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+// the temporary files are named "<record>.<pid>.<counter>.tmp", returns 0 for the other names
+pid_t getTmpFileOwner(const std::string& name) {
+    const std::string suffix = ".tmp";
+    if (name.size() <= suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return 0;
+    }
+    const auto counterPos = name.rfind('.', name.size() - suffix.size() - 1);
+    if (counterPos == std::string::npos || counterPos == 0) {
+        return 0;
+    }
+    const auto pidPos = name.rfind('.', counterPos - 1);
+    if (pidPos == std::string::npos) {
+        return 0;
+    }
+    const auto pid = name.substr(pidPos + 1, counterPos - pidPos - 1);
+    if (pid.empty() || pid.find_first_not_of("0123456789") != std::string::npos || pid.size() > 9) {
+        return 0;
+    }
+    return static_cast<pid_t>(std::stol(pid));
+}
+
+// removes the record file if no process maps it, i.e. holds the shared lock on it
+bool removeIfUnused(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+    if (fd < 0) {
+        return false;
+    }
+    bool removed = false;
+    struct stat fdStat {};
+    struct stat pathStat {};
+    if (flock(fd, LOCK_EX | LOCK_NB) == 0 && fstat(fd, &fdStat) == 0 && fdStat.st_nlink > 0 &&
+        stat(path.c_str(), &pathStat) == 0 && fdStat.st_dev == pathStat.st_dev && fdStat.st_ino == pathStat.st_ino) {
+        removed = unlink(path.c_str()) == 0;
+    }
+    close(fd);
+    return removed;
+}
+
+// removes the temporary files left by the processes which crashed while publishing a record, a file of a process
+// running in another pid namespace may be removed as well, which only makes its publication fail
+void removeStaleTmpFiles(const std::string& storageDir) {
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(storageDir, ec)) {
+        const auto path = entry.path().string();
+        const auto pid = getTmpFileOwner(entry.path().filename().string());
+        struct stat fileStat {};
+        if (pid <= 0 || pid == getpid() || lstat(path.c_str(), &fileStat) != 0 || !isTrusted(fileStat)) {
+            continue;
+        }
+        if (kill(pid, 0) != 0 && errno == ESRCH) {
+            unlink(path.c_str());
+        }
+    }
+}
+
+}  // namespace
+
+/**
+ * @brief Mapping of a record, holds the shared lock on the record file while the mapping is alive
+ */
+class SharedWeightsStorage::Record {
+public:
+    Record(int fd, void* addr, size_t size, std::string path, bool persistent)
+        : m_fd(fd),
+          m_addr(addr),
+          m_size(size),
+          m_path(std::move(path)),
+          m_persistent(persistent) {}
+
+    Record(const Record&) = delete;
+    Record& operator=(const Record&) = delete;
+
+    ~Record() {
+        munmap(m_addr, m_size);
+        // the exclusive lock can only be taken if no other process holds the record
+        if (!m_persistent && flock(m_fd, LOCK_EX | LOCK_NB) == 0) {
+            struct stat fdStat {};
+            struct stat pathStat {};
+            // the path may already refer to a newer record if this one has been removed by another process
+            if (fstat(m_fd, &fdStat) == 0 && fdStat.st_nlink > 0 && stat(m_path.c_str(), &pathStat) == 0 &&
+                fdStat.st_dev == pathStat.st_dev && fdStat.st_ino == pathStat.st_ino) {
+                unlink(m_path.c_str());
+            }
+        }
+        close(m_fd);
+    }
+
+    /**
+     * @brief Maps the published record
+     * @param retry is set if the record exists but cannot be used at the moment, or it is invalid and has been removed
+     * @return the record or nullptr if there is no valid record
+     */
+    static std::shared_ptr<Record> open(const std::string& path,
+                                        const Sha256::Digest& keyDigest,
+                                        size_t dataSize,
+                                        bool persistent,
+                                        bool& retry) {
+        retry = false;
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat fdStat {};
+        if (fstat(fd, &fdStat) != 0 || !isTrusted(fdStat) || flock(fd, LOCK_SH) != 0 || fstat(fd, &fdStat) != 0) {
+            close(fd);
+            return nullptr;
+        }
+        if (fdStat.st_nlink == 0) {
+            // has been removed by the last user
+            close(fd);
+            retry = true;
+            return nullptr;
+        }
+
+        const size_t fileSize = dataOffset + dataSize;
+        if (static_cast<size_t>(fdStat.st_size) != fileSize) {
+            close(fd);
+            return nullptr;
+        }
+        void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+
+        auto record = std::make_shared<Record>(fd, addr, fileSize, path, persistent);
+        const auto* header = static_cast<const RecordHeader*>(addr);
+        if (header->magic != recordMagic || header->version != recordVersion || header->keyDigest != keyDigest ||
+            header->dataSize != dataSize || header->dataHash != hashData(record->getData(), dataSize)) {
+            // the record cannot become valid, so it is removed unless it is mapped by another process, and replaced
+            record->m_persistent = false;
+            retry = true;
+            return nullptr;
+        }
+        if (persistent) {
+            // the modification time orders the records for the eviction
+            futimens(fd, nullptr);
+        }
+        return record;
+    }
+
+    /**
+     * @brief Writes the memory content to a new record and publishes it
+     * @param exists is set if the record has been published by another process in the meantime
+     * @return the record or nullptr if the record has not been published
+     */
+    static std::shared_ptr<Record> publish(const std::string& path,
+                                           const Sha256::Digest& keyDigest,
+                                           const IMemory& memory,
+                                           bool persistent,
+                                           bool& exists) {
+        exists = false;
+        static std::atomic_size_t tmpCounter{0};
+        const auto tmpPath =
+            path + "." + std::to_string(getpid()) + "." + std::to_string(tmpCounter.fetch_add(1)) + ".tmp";
+
+        const int fd = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        auto discard = [&](void* addr, size_t size) {
+            if (addr != nullptr) {
+                munmap(addr, size);
+            }
+            unlink(tmpPath.c_str());
+            close(fd);
+            return nullptr;
+        };
+
+        const size_t dataSize = memory.getSize();
+        const size_t fileSize = dataOffset + dataSize;
+        // allocate the blocks in advance, since a write to the mapping of a sparse file may crash the process with
+        // SIGBUS when the storage runs out of space
+        if (posix_fallocate(fd, 0, static_cast<off_t>(fileSize)) != 0) {
+            return discard(nullptr, 0);
+        }
+        void* addr = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            return discard(nullptr, 0);
+        }
+
+        RecordHeader header{};
+        header.magic = recordMagic;
+        header.version = recordVersion;
+        header.dataSize = dataSize;
+        header.dataHash = hashData(memory.getData(), dataSize);
+        header.keyDigest = keyDigest;
+        std::memcpy(addr, &header, sizeof(header));
+        std::memcpy(static_cast<uint8_t*>(addr) + dataOffset, memory.getData(), dataSize);
+
+        if (mprotect(addr, fileSize, PROT_READ) != 0 || flock(fd, LOCK_SH) != 0) {
+            return discard(addr, fileSize);
+        }
+        // unlike rename, link fails if the record already exists, so there is a single copy of the record on the host
+        if (link(tmpPath.c_str(), path.c_str()) != 0) {
+            exists = errno == EEXIST;
+            return discard(addr, fileSize);
+        }
+        unlink(tmpPath.c_str());
+
+        return std::make_shared<Record>(fd, addr, fileSize, path, persistent);
+    }
+
+    [[nodiscard]] void* getData() const {
+        return static_cast<uint8_t*>(m_addr) + dataOffset;
+    }
+
+private:
+    int m_fd;
+    void* m_addr;
+    size_t m_size;
+    std::string m_path;
+    bool m_persistent;
+};
+
+SharedWeightsStorage::SharedWeightsStorage(std::string storageDir, int socketId, bool persistent, uint64_t maxSize)
+    : m_storageDir(std::move(storageDir)),
+      m_socketId(socketId),
+      m_persistent(persistent),
+      m_maxSize(maxSize) {
+    std::error_code ec;
+    if (std::filesystem::create_directories(m_storageDir, ec)) {
+        std::filesystem::permissions(m_storageDir, std::filesystem::perms::owner_all, ec);
+    }
+    removeStaleTmpFiles(m_storageDir);
+
+    if (m_persistent && m_maxSize == 0) {
+        m_maxSize = defaultMaxSize;
+    }
+}
+
+SharedWeightsStorage::Ptr SharedWeightsStorage::create(const std::string& storageDir,
+                                                       int socketId,
+                                                       bool persistent,
+                                                       uint64_t maxSize) {
+    if (storageDir.empty()) {
+        return nullptr;
+    }
+    return std::make_shared<SharedWeightsStorage>(storageDir, socketId, persistent, maxSize);
+}
+
+std::string SharedWeightsStorage::getRecordPath(const std::string& key) const {
+    return (std::filesystem::path(m_storageDir) / (key + "_" + std::to_string(m_socketId) + ".bin")).string();
+}
+
+bool SharedWeightsStorage::makeRoom(uint64_t recordSize) const {
+    if (recordSize > m_maxSize) {
+        return false;
+    }
+
+    struct RecordFile {
+        std::string path;
+        uint64_t size;
+        struct timespec lastUse;
+    };
+    std::vector<RecordFile> records;
+    uint64_t totalSize = 0;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(m_storageDir, ec)) {
+        const auto path = entry.path().string();
+        struct stat fileStat {};
+        if (entry.path().extension() != ".bin" || lstat(path.c_str(), &fileStat) != 0 || !isTrusted(fileStat)) {
+            continue;
+        }
+        records.push_back({path, static_cast<uint64_t>(fileStat.st_size), fileStat.st_mtim});
+        totalSize += records.back().size;
+    }
+    if (totalSize + recordSize <= m_maxSize) {
+        return true;
+    }
+
+    std::sort(records.begin(), records.end(), [](const RecordFile& lhs, const RecordFile& rhs) {
+        return lhs.lastUse.tv_sec != rhs.lastUse.tv_sec ? lhs.lastUse.tv_sec < rhs.lastUse.tv_sec
+                                                        : lhs.lastUse.tv_nsec < rhs.lastUse.tv_nsec;
+    });
+    for (const auto& record : records) {
+        if (totalSize + recordSize <= m_maxSize) {
+            break;
+        }
+        if (removeIfUnused(record.path)) {
+            totalSize -= record.size;
+        }
+    }
+    return totalSize + recordSize <= m_maxSize;
+}
+
+MemoryPtr SharedWeightsStorage::findOrCreate(const std::string& key,
+                                             const dnnl::engine& eng,
+                                             const MemoryDescPtr& desc,
+                                             const std::function<MemoryPtr(void)>& create) const {
+    const auto path = getRecordPath(key);
+    const auto keyDigest = Sha256::digest(key.data(), key.size());
+    const size_t dataSize = desc->getCurrentMemSize();
+    MemoryPtr memory;
+
+    for (size_t attempt = 0; attempt < maxAttempts; ++attempt) {
+        bool retry = false;
+        auto record = Record::open(path, keyDigest, dataSize, m_persistent, retry);
+        if (!record) {
+            if (retry) {
+                continue;
+            }
+            if (!memory) {
+                memory = create();
+            }
+            if (m_persistent && !makeRoom(dataOffset + dataSize)) {
+                return memory;
+            }
+            bool exists = false;
+            record = Record::publish(path, keyDigest, *memory, m_persistent, exists);
+            if (!record) {
+                if (exists) {
+                    continue;
+                }
+                // the storage is just an optimization, so the private copy is used
+                return memory;
+            }
+        }
+
+        // the record is kept mapped until the memory object is destroyed
+        auto mapped = std::make_unique<Memory>(eng, desc, record->getData(), false);
+        return MemoryPtr(mapped.release(), [record](Memory* ptr) {
+            delete ptr;
+        });
+    }
+
+    return memory ? memory : create();
+}
+
+#else
+
+SharedWeightsStorage::SharedWeightsStorage(std::string storageDir, int socketId, bool persistent, uint64_t maxSize)
+    : m_storageDir(std::move(storageDir)),
+      m_socketId(socketId),
+      m_persistent(persistent),
+      m_maxSize(maxSize) {
+    OPENVINO_THROW("Shared weights storage is not supported on Windows");
+}
+
+SharedWeightsStorage::Ptr SharedWeightsStorage::create(const std::string& storageDir,
+                                                       int socketId,
+                                                       bool persistent,
+                                                       uint64_t maxSize) {
+    if (storageDir.empty()) {
+        return nullptr;
+    }
+    return std::make_shared<SharedWeightsStorage>(storageDir, socketId, persistent, maxSize);
+}
+
+std::string SharedWeightsStorage::getRecordPath(const std::string& key) const {
+    return key;
+}
+
+MemoryPtr SharedWeightsStorage::findOrCreate([[maybe_unused]] const std::string& key,
+                                             [[maybe_unused]] const dnnl::engine& eng,
+                                             [[maybe_unused]] const MemoryDescPtr& desc,
+                                             const std::function<MemoryPtr(void)>& create) const {
+    return create();
+}
+
+#endif
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <string>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Storage of the repacked weights shared between the processes running on the same host.
+ * Each record is a file in the storage directory (a tmpfs mount like /dev/shm is expected), which is mapped to the
+ * address space of all the processes using the same weights. A record is identified by a key derived from the weights
+ * content and the target layout, and by the socket id, so the processes on each NUMA node share a separate copy.
+ *
+ * The record is published atomically: it is written to a temporary file which is then linked to the record path, so
+ * the other processes either see a complete record or no record at all. The processes mapping the record hold a
+ * shared advisory lock on it, which serves as a reference counter maintained by the OS: the last process releasing
+ * the record (or the next one releasing it after a crash) removes the file. A persistent storage keeps the released
+ * records, so they are reused by the processes started later. Its size is bounded: the least recently used records not
+ * mapped by any process are removed to make room for a new one, and a record which does not fit is not published.
+ *
+ * Only the records owned by the current user and not writable by the group or the others are mapped. A record header
+ * holds the format version, the digest of the key and the hash of the data, which are verified before the record is
+ * used, and an invalid record is replaced. The key holds the SHA-256 digest of the source weights (see
+ * DnnlExtensionUtils::computeWeightsContentHash), so the record of other weights is not mapped. The temporary files
+ * left by the crashed processes are removed when the storage is created.
+ *
+ * @note The records are mapped read only, so the weights must not be modified after the creation.
+ * @note Not supported on Windows.
+ */
+class SharedWeightsStorage {
+public:
+    using Ptr = std::shared_ptr<SharedWeightsStorage>;
+
+    /**
+     * @param storageDir is the directory to store the records in, it is created if it does not exist
+     * @param socketId is the id of the socket the weights are placed on
+     * @param persistent keeps the records after the last process releases them
+     * @param maxSize is the size bound of the persistent storage in bytes, 0 is 4 GiB
+     */
+    SharedWeightsStorage(std::string storageDir, int socketId, bool persistent = false, uint64_t maxSize = 0);
+
+    /**
+     * @brief Creates the storage for the given socket
+     * @param storageDir is the directory to store the records in
+     * @param socketId is the id of the socket the weights are placed on
+     * @param persistent keeps the records after the last process releases them
+     * @param maxSize is the size bound of the persistent storage in bytes, 0 is 4 GiB
+     * @return the storage or nullptr if storageDir is empty
+     */
+    static Ptr create(const std::string& storageDir, int socketId, bool persistent = false, uint64_t maxSize = 0);
+
+    /**
+     * @brief Maps the record published under the key by any process, or creates the memory and publishes it
+     * @param key identifies the memory content in all the processes
+     * @param eng is the engine the returned memory object is bound to
+     * @param desc is the descriptor of the memory
+     * @param create is a functor creating the memory if there is no valid record
+     * @return the memory mapped from the record, or the memory returned by create if the record cannot be published
+     */
+    MemoryPtr findOrCreate(const std::string& key,
+                           const dnnl::engine& eng,
+                           const MemoryDescPtr& desc,
+                           const std::function<MemoryPtr(void)>& create) const;
+
+    [[nodiscard]] const std::string& getStorageDir() const {
+        return m_storageDir;
+    }
+
+private:
+    class Record;
+
+    [[nodiscard]] std::string getRecordPath(const std::string& key) const;
+
+    /**
+     * @brief Removes the least recently used records not mapped by any process until a new record fits the size bound
+     * @return false if the record does not fit
+     */
+    [[nodiscard]] bool makeRoom(uint64_t recordSize) const;
+
+    std::string m_storageDir;
+    int m_socketId;
+    bool m_persistent;
+    uint64_t m_maxSize;
+};
+
+}  // namespace ov::intel_cpu
@@ -41,6 +41,58 @@ public:
         _memorys_table[(memory_id + 1) % 2][sub_stream_id].last_used = false;
     }
 
+    // Takes the memory slot for the next synchronization of the sub-streams, waits until all the sub-streams
+    // have released the slot after its previous use. Returns the memory id or -1 if there is no free slot.
+    int acquire_memory(int sub_stream_id) {
+        const int memory_id = get_memory_id(sub_stream_id);
+        if (memory_id < 0) {
+            return memory_id;
+        }
+        set_memory_used(memory_id, sub_stream_id);
+        while (true) {
+            std::lock_guard<std::mutex> lock(_flagMutex);
+            if (_use_count[memory_id] == _num_sub_streams) {
+                _use_count[memory_id] = 0;
+                for (int i = 0; i < _num_sub_streams; i++) {
+                    _memorys_table[memory_id][i].flag = false;
+                }
+            }
+            if (_use_count[memory_id] == 0) {
+                break;
+            }
+        }
+        return memory_id;
+    }
+
+    void share_memory(int memory_id, int sub_stream_id, void* buf) {
+        _memorys_table[memory_id][sub_stream_id].send_buf = buf;
+        _memorys_table[memory_id][sub_stream_id].flag = true;
+    }
+
+    // Calls func(sub_stream_id, buf) for the memory of every sub-stream as soon as it is shared
+    template <typename F>
+    void for_each_shared_memory(int memory_id, const F& func) {
+        std::vector<int> wait_list(_num_sub_streams, 1);
+        while (true) {
+            int wait_size = 0;
+            for (int idx = 0; idx < _num_sub_streams; idx++) {
+                if (wait_list[idx] > 0 && _memorys_table[memory_id][idx].flag) {
+                    func(idx, _memorys_table[memory_id][idx].send_buf);
+                    wait_list[idx] = 0;
+                }
+                wait_size += wait_list[idx];
+            }
+            if (wait_size == 0) {
+                break;
+            }
+        }
+    }
+
+    void release_memory(int memory_id) {
+        std::lock_guard<std::mutex> lock(_flagMutex);
+        _use_count[memory_id]++;
+    }
+
     int _num_sub_streams;
     std::vector<std::vector<MemoryInfo>> _memorys_table;
     std::vector<int> _use_count;
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::SamplingNode::SamplingNode(const ov::Output<Node>& logits,
+                                          const ov::Output<Node>& num_samples,
+                                          const ov::Output<Node>& temperature,
+                                          const ov::Output<Node>& top_k,
+                                          const ov::Output<Node>& top_p,
+                                          const uint64_t global_seed,
+                                          const uint64_t op_seed)
+    : Op({logits, num_samples, temperature, top_k, top_p}),
+      m_global_seed(global_seed),
+      m_op_seed(op_seed) {
+    validate_and_infer_types();
+}
+
+ov::intel_cpu::SamplingNode::SamplingNode(const ov::Output<Node>& logits,
+                                          const ov::Output<Node>& num_samples,
+                                          const ov::Output<Node>& temperature,
+                                          const ov::Output<Node>& top_k,
+                                          const ov::Output<Node>& top_p,
+                                          const ov::Output<Node>& row_ids,
+                                          const uint64_t global_seed,
+                                          const uint64_t op_seed)
+    : Op({logits, num_samples, temperature, top_k, top_p, row_ids}),
+      m_global_seed(global_seed),
+      m_op_seed(op_seed) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::SamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(SamplingNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 6) {
+        return std::make_shared<ov::intel_cpu::SamplingNode>(new_args.at(0),
+                                                             new_args.at(1),
+                                                             new_args.at(2),
+                                                             new_args.at(3),
+                                                             new_args.at(4),
+                                                             new_args.at(5),
+                                                             m_global_seed,
+                                                             m_op_seed);
+    }
+    return std::make_shared<ov::intel_cpu::SamplingNode>(new_args.at(0),
+                                                         new_args.at(1),
+                                                         new_args.at(2),
+                                                         new_args.at(3),
+                                                         new_args.at(4),
+                                                         m_global_seed,
+                                                         m_op_seed);
+}
+
+bool ov::intel_cpu::SamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(SamplingNode_visit_attributes);
+    visitor.on_attribute("global_seed", m_global_seed);
+    visitor.on_attribute("op_seed", m_op_seed);
+    return true;
+}
+
+void ov::intel_cpu::SamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(SamplingNode_validate_and_infer_types);
+    const auto& logits_et = get_input_element_type(0);
+    const auto& logits_shape = get_input_partial_shape(0);
+    OPENVINO_ASSERT(logits_et.is_real(), "'logits' input must be real whereas current element type is", logits_et);
+    OPENVINO_ASSERT(logits_shape.rank().compatible(2),
+                    "'logits' input must have 2D shape whereas current shape is",
+                    logits_shape);
+
+    const auto& num_samples_et = get_input_element_type(1);
+    const auto& top_k_et = get_input_element_type(3);
+    OPENVINO_ASSERT(num_samples_et.is_integral_number(),
+                    "'num_samples' input must be integer whereas current element type is",
+                    num_samples_et);
+    OPENVINO_ASSERT(top_k_et.is_integral_number(),
+                    "'top_k' input must be integer whereas current element type is",
+                    top_k_et);
+    OPENVINO_ASSERT(get_input_size() == 5 || get_input_size() == 6,
+                    "Sampling must have 5 or 6 inputs whereas it has ",
+                    get_input_size());
+    if (get_input_size() == 6) {
+        const auto& row_ids_et = get_input_element_type(5);
+        OPENVINO_ASSERT(row_ids_et.is_integral_number(),
+                        "'row_ids' input must be integer whereas current element type is",
+                        row_ids_et);
+    }
+
+    ov::PartialShape out_shape{ov::Dimension::dynamic(), ov::Dimension::dynamic()};
+    if (logits_shape.rank().is_static()) {
+        out_shape[0] = logits_shape[0];
+    }
+    if (const auto num_samples = ov::as_type_ptr<ov::op::v0::Constant>(get_input_node_shared_ptr(1))) {
+        out_shape[1] = num_samples->cast_vector<int64_t>()[0];
+    }
+    set_output_type(0, ov::element::i32, out_shape);
+}
+
+uint64_t ov::intel_cpu::SamplingNode::get_global_seed() const {
+    return m_global_seed;
+}
+
+uint64_t ov::intel_cpu::SamplingNode::get_op_seed() const {
+    return m_op_seed;
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+
+namespace ov::intel_cpu {
+/**
+ * The operation draws samples of token indices directly from logits, fusing temperature scaling, top-k selection,
+ * top-p (nucleus) truncation and multinomial sampling with replacement. Inputs:
+ *     1. Logits of type T1 - shape [B, V], where B - batch size, V - vocabulary size. Required
+ *     2. Number of samples of type T2 - scalar or 1D single element tensor. Required
+ *     3. Temperature of type T1 - scalar or tensor of B elements. Zero temperature means greedy sampling. Required
+ *     4. Top-k of type T2 - scalar or tensor of B elements. Zero disables top-k selection. Required
+ *     5. Top-p of type T1 - scalar or tensor of B elements. One disables top-p truncation. Required
+ *     6. Row ids of type T2 - tensor of B elements, e.g. the ids of the sequences in the batch. Optional
+ * Outputs:
+ *     1. Indices of the sampled logits of type I32 - shape [B, N], where N - number of samples.
+ * Types:
+ *     T1 - FP32, FP16 and BF16 are supported
+ *     T2 - I32 and I64 are supported
+ * The candidates are ordered as the sorted outputs of TopK, and top-p keeps the ones whose preceding probability mass
+ * is less than top_p. Every row draws its random values from its own generator seeded by the global and the operation
+ * seeds and the row id, which is the index of the row if the row ids are not given. So the samples of a sequence do not
+ * depend on the other rows of the batch, while they differ from the ones of the unfused Multinomial, which draws the
+ * random values of all the rows from a single generator.
+ */
+class SamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("Sampling", "cpu_plugin_opset");
+
+    SamplingNode() = default;
+    SamplingNode(const ov::Output<Node>& logits,
+                 const ov::Output<Node>& num_samples,
+                 const ov::Output<Node>& temperature,
+                 const ov::Output<Node>& top_k,
+                 const ov::Output<Node>& top_p,
+                 uint64_t global_seed,
+                 uint64_t op_seed);
+    SamplingNode(const ov::Output<Node>& logits,
+                 const ov::Output<Node>& num_samples,
+                 const ov::Output<Node>& temperature,
+                 const ov::Output<Node>& top_k,
+                 const ov::Output<Node>& top_p,
+                 const ov::Output<Node>& row_ids,
+                 uint64_t global_seed,
+                 uint64_t op_seed);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+    uint64_t get_global_seed() const;
+    uint64_t get_op_seed() const;
+
+private:
+    uint64_t m_global_seed = 0;
+    uint64_t m_op_seed = 0;
+};
+}  // namespace ov::intel_cpu
@@ -0,0 +1,201 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling_fusion.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/cum_sum.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/util/gather_base.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+
+namespace {
+
+bool is_last_axis(const int64_t axis, const ov::Output<ov::Node>& data) {
+    const auto& rank = data.get_partial_shape().rank();
+    return rank.is_static() && (axis == -1 || axis == rank.get_length() - 1);
+}
+
+// the temperature and top-p must be either common or per batch row of the [B, V] logits
+bool is_row_parameter_shape(const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic() || shape.size() > 2) {
+        return false;
+    }
+    if (shape.size() == 2) {
+        return shape[1] == 1;
+    }
+    // 1D divisor is broadcast along the vocabulary, so it may only be a single element
+    return shape.size() == 0 || shape[0] == 1;
+}
+
+bool is_scalar_constant(const ov::Output<ov::Node>& output, float value) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    return constant && ov::shape_size(constant->get_shape()) == 1 && constant->cast_vector<float>()[0] == value;
+}
+
+// the nucleus truncation of the sorted probabilities: Select(Less(CumSum(probs, exclusive), top_p), probs, 0),
+// if it is matched, the probabilities are replaced by the ones before the truncation
+bool match_top_p(ov::Output<ov::Node>& probs, ov::Output<ov::Node>& top_p, ov::NodeVector& fused_nodes) {
+    const auto select = ov::as_type_ptr<ov::op::v1::Select>(probs.get_node_shared_ptr());
+    if (!select || probs.get_target_inputs().size() != 1 || !is_scalar_constant(select->input_value(2), 0.0F)) {
+        return false;
+    }
+    const auto less = ov::as_type_ptr<ov::op::v1::Less>(select->get_input_node_shared_ptr(0));
+    if (!less || less->get_output_target_inputs(0).size() != 1 ||
+        !is_row_parameter_shape(less->get_input_partial_shape(1))) {
+        return false;
+    }
+    const auto cumsum = ov::as_type_ptr<ov::op::v0::CumSum>(less->get_input_node_shared_ptr(0));
+    const auto sorted_probs = select->input_value(1);
+    if (!cumsum || cumsum->get_output_target_inputs(0).size() != 1 || !cumsum->is_exclusive() ||
+        cumsum->is_reverse() || cumsum->input_value(0) != sorted_probs) {
+        return false;
+    }
+    const auto axis = ov::as_type_ptr<ov::op::v0::Constant>(cumsum->get_input_node_shared_ptr(1));
+    if (!axis || ov::shape_size(axis->get_shape()) != 1 ||
+        !is_last_axis(axis->cast_vector<int64_t>()[0], sorted_probs)) {
+        return false;
+    }
+    fused_nodes.push_back(select);
+    fused_nodes.push_back(less);
+    fused_nodes.push_back(cumsum);
+    probs = sorted_probs;
+    top_p = less->input_value(1);
+    return true;
+}
+
+}  // namespace
+
+ov::intel_cpu::SamplingFusion::SamplingFusion() {
+    MATCHER_SCOPE(SamplingFusion);
+    using namespace ov::pass::pattern;
+    auto multinomial_m = wrap_type<ov::op::v13::Multinomial>({any_input(rank_equals(2)), any_input()});
+
+    ov::matcher_pass_callback callback = [](Matcher& m) {
+        const auto multinomial = ov::as_type_ptr<ov::op::v13::Multinomial>(m.get_match_root());
+        if (!multinomial) {
+            return false;
+        }
+        const auto num_samples = multinomial->input_value(1);
+        if (!multinomial->get_with_replacement()) {
+            // sampling without replacement is the same only for a single sample
+            const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(num_samples.get_node_shared_ptr());
+            if (!constant || constant->cast_vector<int64_t>() != std::vector<int64_t>{1}) {
+                return false;
+            }
+        }
+
+        ov::NodeVector fused_nodes{multinomial};
+        auto logits = multinomial->input_value(0);
+        const auto logits_et = logits.get_element_type();
+        ov::Output<ov::Node> top_p = ov::op::v0::Constant::create(logits_et, ov::Shape{}, {1.0F});
+        bool has_top_p = false;
+        if (!multinomial->get_log_probs()) {
+            has_top_p = match_top_p(logits, top_p, fused_nodes);
+
+            const auto softmax = logits.get_node_shared_ptr();
+            int64_t axis = 0;
+            if (const auto softmax_v1 = ov::as_type_ptr<ov::op::v1::Softmax>(softmax)) {
+                axis = static_cast<int64_t>(softmax_v1->get_axis());
+            } else if (const auto softmax_v8 = ov::as_type_ptr<ov::op::v8::Softmax>(softmax)) {
+                axis = softmax_v8->get_axis();
+            } else {
+                return false;
+            }
+            // the truncated probabilities are consumed by both CumSum and Select
+            if (logits.get_target_inputs().size() != (has_top_p ? 2 : 1) ||
+                !is_last_axis(axis, softmax->input_value(0))) {
+                return false;
+            }
+            fused_nodes.push_back(softmax);
+            logits = softmax->input_value(0);
+        }
+
+        ov::Output<ov::Node> temperature = ov::op::v0::Constant::create(logits_et, ov::Shape{}, {1.0F});
+        bool divide_fused = false;
+        const auto divide = ov::as_type_ptr<ov::op::v1::Divide>(logits.get_node_shared_ptr());
+        if (divide && logits.get_target_inputs().size() == 1 &&
+            is_row_parameter_shape(divide->get_input_partial_shape(1))) {
+            fused_nodes.push_back(divide);
+            divide_fused = true;
+            temperature = divide->input_value(1);
+            logits = divide->input_value(0);
+        }
+
+        // the samples of the top-k values are mapped back to the vocabulary by Gather of the top-k indices,
+        // the values must be sorted, as the fused sampling orders the candidates so
+        ov::Output<ov::Node> top_k = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        std::shared_ptr<ov::Node> root = multinomial;
+        bool topk_fused = false;
+        const auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(logits.get_node_shared_ptr());
+        if (topk && logits.get_index() == 0 && logits.get_target_inputs().size() == 1 &&
+            topk->get_mode() == ov::op::TopKMode::MAX && topk->get_sort_type() == ov::op::TopKSortType::SORT_VALUES &&
+            is_last_axis(topk->get_provided_axis(), topk->input_value(0))) {
+            const auto& consumers = multinomial->get_output_target_inputs(0);
+            const auto gather = consumers.size() == 1 ? ov::as_type_ptr<ov::op::util::GatherBase>(
+                                                            consumers.begin()->get_node()->shared_from_this())
+                                                      : nullptr;
+            if (gather && gather->input_value(0) == topk->output(1) &&
+                gather->input_value(1) == multinomial->output(0) && topk->get_output_target_inputs(1).size() == 1 &&
+                is_last_axis(gather->get_axis(), gather->input_value(0)) &&
+                (gather->get_batch_dims() == 1 || gather->get_batch_dims() == -1)) {
+                fused_nodes.push_back(topk);
+                fused_nodes.push_back(gather);
+                root = gather;
+                topk_fused = true;
+                top_k = topk->input_value(1);
+                logits = topk->input_value(0);
+            }
+        }
+        // top-p truncates the probabilities sorted by TopK, while the plain Softmax -> Multinomial chain
+        // gains nothing from the fusion
+        if (!topk_fused && (has_top_p || !divide_fused)) {
+            return false;
+        }
+
+        const auto sampling = std::make_shared<ov::intel_cpu::SamplingNode>(logits,
+                                                                            num_samples,
+                                                                            temperature,
+                                                                            top_k,
+                                                                            top_p,
+                                                                            multinomial->get_global_seed(),
+                                                                            multinomial->get_op_seed());
+        std::shared_ptr<ov::Node> result = sampling;
+        if (root->get_output_element_type(0) != sampling->get_output_element_type(0)) {
+            sampling->set_friendly_name(root->get_friendly_name() + "/Sampling");
+            result = std::make_shared<ov::op::v0::Convert>(sampling, root->get_output_element_type(0));
+        }
+        result->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, {sampling, result});
+        ov::replace_node(root, result);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(multinomial_m, matcher_name);
+    this->register_matcher(m, callback);
+}
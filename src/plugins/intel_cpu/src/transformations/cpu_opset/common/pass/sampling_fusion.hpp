@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the sampling subgraph of a text generation model into SamplingNode:
+ *
+ *      logits -> [TopK -> values] -> [Divide by temperature] -> Softmax -> [top-p] -> Multinomial
+ *             -> [Gather of TopK indices]
+ *
+ * where top-p is Select(Less(CumSum(probs, exclusive), top_p), probs, 0) of the probabilities sorted by TopK.
+ * Either TopK or Divide must be present. Multinomial with log_probs may take the (scaled) logits without Softmax.
+ */
+class SamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("SamplingFusion");
+    SamplingFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -5,6 +5,7 @@
 #include "mlp_fusion.hpp"
 
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "openvino/cc/pass/itt.hpp"
@@ -30,6 +31,7 @@
 #include "openvino/util/pp.hpp"
 #include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
 #include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
+#include "transformations/utils.hpp"
 
 using namespace ov::pass;
 using namespace ov::pass::pattern;
@@ -87,6 +89,11 @@ ov::intel_cpu::MLPFusionPass::MLPFusionPass() {
     auto down_proj_weight_deq =
         wrap_type<Multiply>({down_proj_weight_f32, down_proj_weight_scales_per_OC}, {{"auto_broadcast", "numpy"}});
 
+    // per OC u8/i8 compressed version (with zero points), converted to the symmetric INT8 per OC (in callback)
+    auto gate_proj_weight_int8_compressed = any_input(is_int8_per_oc_compressed_weights);
+    auto up_proj_weight_int8_compressed = any_input(is_int8_per_oc_compressed_weights);
+    auto down_proj_weight_int8_compressed = any_input(is_int8_per_oc_compressed_weights);
+
     // gate-up weights are combined
     auto gate_up_proj_weight = wrap_type<Constant>(type_matches(element::f16) && rank_equals(2));
     auto gate_up_proj_weight_f32 = wrap_type<Convert>(gate_up_proj_weight, {{"destination_type", "f32"}});
@@ -97,24 +104,33 @@ ov::intel_cpu::MLPFusionPass::MLPFusionPass() {
     auto gate_up_proj_weight_deq = wrap_type<Multiply>({gate_up_proj_weight_cvt_f32, gate_up_proj_weight_scales_per_OC},
                                                        {{"auto_broadcast", "numpy"}});
 
-    auto gate_up_proj = wrap_type<MatMul>({input, gate_up_proj_weight_f32 | gate_up_proj_weight_deq},
-                                          {{"transpose_a", false}, {"transpose_b", true}});
+    auto gate_up_proj_weight_int8_compressed = any_input(is_int8_per_oc_compressed_weights);
+
+    auto gate_up_proj =
+        wrap_type<MatMul>({input,
+                           gate_up_proj_weight_f32 | gate_up_proj_weight_deq | gate_up_proj_weight_int8_compressed},
+                          {{"transpose_a", false}, {"transpose_b", true}});
     auto gate_up_split_lengths = wrap_type<Constant>(type_matches(element::i32) && shape_matches("[2]"));
     auto gate_up_proj_split = wrap_type<VariadicSplit>({gate_up_proj, -1, gate_up_split_lengths});
     gate_up_proj_split->set_output_size(2);
 
     auto mlp_gate_proj =
-        wrap_type<MatMul>({input, gate_proj_weight | gate_proj_weight_compressed | gate_proj_weight_deq},
+        wrap_type<MatMul>({input,
+                           gate_proj_weight | gate_proj_weight_compressed | gate_proj_weight_deq |
+                               gate_proj_weight_int8_compressed},
                           {{"transpose_a", false}, {"transpose_b", true}});
     auto mlp_silu_gate = wrap_type<Swish>({mlp_gate_proj | gate_up_proj_split});
     auto mlp_gelu_gate = wrap_type<Gelu>({mlp_gate_proj | gate_up_proj_split});
-    auto mlp_up_proj = wrap_type<MatMul>({input, up_proj_weight | up_proj_weight_compressed | up_proj_weight_deq},
-                                         {{"transpose_a", false}, {"transpose_b", true}});
+    auto mlp_up_proj = wrap_type<MatMul>(
+        {input, up_proj_weight | up_proj_weight_compressed | up_proj_weight_deq | up_proj_weight_int8_compressed},
+        {{"transpose_a", false}, {"transpose_b", true}});
 
     auto mlp_gated_up = wrap_type<Multiply>({mlp_silu_gate | mlp_gelu_gate, mlp_up_proj | gate_up_proj_split},
                                             {{"auto_broadcast", "numpy"}});
     auto down_proj =
-        wrap_type<MatMul>({mlp_gated_up, down_proj_weight | down_proj_weight_compressed | down_proj_weight_deq},
+        wrap_type<MatMul>({mlp_gated_up,
+                           down_proj_weight | down_proj_weight_compressed | down_proj_weight_deq |
+                               down_proj_weight_int8_compressed},
                           {{"transpose_a", false}, {"transpose_b", true}});
 
     auto result = down_proj;
@@ -130,18 +146,73 @@ ov::intel_cpu::MLPFusionPass::MLPFusionPass() {
         Output<Node> gate_proj_w;
         Output<Node> up_proj_w;
         Output<Node> down_proj_w;
+        Output<Node> gate_proj_scales;
+        Output<Node> up_proj_scales;
+        Output<Node> down_proj_scales;
+
+        // takes either the symmetrically INT8 quantized weights or the converted compressed ones
+        auto get_int8_weights = [&](const std::shared_ptr<Node>& weight_i8,
+                                    const std::shared_ptr<Node>& weight_scales_per_OC,
+                                    const std::shared_ptr<Node>& weight_int8_compressed,
+                                    Output<Node>& weight,
+                                    Output<Node>& scales) {
+            if (pattern_map.count(weight_i8) > 0) {
+                weight = pattern_map.at(weight_i8);
+                scales = pattern_map.at(weight_scales_per_OC);
+                return true;
+            }
+            if (pattern_map.count(weight_int8_compressed) == 0) {
+                return false;
+            }
+            auto converted = convert_to_per_oc_i8(pattern_map.at(weight_int8_compressed));
+            if (!converted) {
+                return false;
+            }
+            weight = converted->weights;
+            scales = converted->scales;
+            return true;
+        };
 
         // down projection is harder to quantize w/o causing accuracy problem, so it may be un-quantized instead
         bool is_gate_up_quantized_int8 = false;
         bool is_down_proj_int8 = false;
         bool is_gate_up_combined = false;
+        auto get_down_proj_weights = [&]() {
+            if (pattern_map.count(down_proj_weight_compressed) > 0) {
+                down_proj_w = pattern_map.at(down_proj_weight_compressed);
+                return true;
+            }
+            is_down_proj_int8 = true;
+            return get_int8_weights(down_proj_weight_i8,
+                                    down_proj_weight_scales_per_OC,
+                                    down_proj_weight_int8_compressed,
+                                    down_proj_w,
+                                    down_proj_scales);
+        };
+
         if (pattern_map.count(gate_up_proj_weight_const_i8) > 0 && pattern_map.count(down_proj_weight_compressed) > 0) {
             // gate-up combined & quantized
             is_gate_up_quantized_int8 = true;
             is_gate_up_combined = true;
             gate_proj_w = pattern_map.at(gate_up_proj_weight_const_i8);
             up_proj_w = pattern_map.at(gate_up_proj_weight_const_i8);
+            gate_proj_scales = pattern_map.at(gate_up_proj_weight_scales_per_OC);
+            up_proj_scales = pattern_map.at(gate_up_proj_weight_scales_per_OC);
             down_proj_w = pattern_map.at(down_proj_weight_compressed);
+        } else if (pattern_map.count(gate_up_proj_weight_int8_compressed) > 0) {
+            // gate-up combined & compressed
+            is_gate_up_quantized_int8 = true;
+            is_gate_up_combined = true;
+            if (!get_int8_weights(gate_up_proj_weight_const_i8,
+                                  gate_up_proj_weight_scales_per_OC,
+                                  gate_up_proj_weight_int8_compressed,
+                                  gate_proj_w,
+                                  gate_proj_scales) ||
+                !get_down_proj_weights()) {
+                return false;
+            }
+            up_proj_w = gate_proj_w;
+            up_proj_scales = gate_proj_scales;
         } else if (pattern_map.count(gate_up_proj_weight) > 0 && pattern_map.count(down_proj_weight_compressed) > 0) {
             // gate-up combined
             is_gate_up_combined = true;
@@ -156,22 +227,21 @@ ov::intel_cpu::MLPFusionPass::MLPFusionPass() {
             gate_proj_w = pattern_map.at(gate_proj_weight_compressed);
             up_proj_w = pattern_map.at(up_proj_weight_compressed);
             down_proj_w = pattern_map.at(down_proj_weight_compressed);
-        } else if (pattern_map.count(gate_proj_weight_i8) > 0 && pattern_map.count(up_proj_weight_i8) > 0 &&
-                   pattern_map.count(gate_proj_weight_scales_per_OC) > 0 &&
-                   pattern_map.count(up_proj_weight_scales_per_OC) > 0) {
+        } else if (pattern_map.count(gate_proj_weight_compressed) == 0 &&
+                   pattern_map.count(up_proj_weight_compressed) == 0) {
             is_gate_up_quantized_int8 = true;
-            gate_proj_w = pattern_map.at(gate_proj_weight_i8);
-            up_proj_w = pattern_map.at(up_proj_weight_i8);
-
-            if (pattern_map.count(down_proj_weight_i8) > 0) {
-                if (pattern_map.count(down_proj_weight_scales_per_OC) == 0) {
-                    return false;
-                }
-                is_down_proj_int8 = true;
-                down_proj_w = pattern_map.at(down_proj_weight_i8);
-            } else {
-                is_down_proj_int8 = false;
-                down_proj_w = pattern_map.at(down_proj_weight_compressed);
+            if (!get_int8_weights(gate_proj_weight_i8,
+                                  gate_proj_weight_scales_per_OC,
+                                  gate_proj_weight_int8_compressed,
+                                  gate_proj_w,
+                                  gate_proj_scales) ||
+                !get_int8_weights(up_proj_weight_i8,
+                                  up_proj_weight_scales_per_OC,
+                                  up_proj_weight_int8_compressed,
+                                  up_proj_w,
+                                  up_proj_scales) ||
+                !get_down_proj_weights()) {
+                return false;
             }
         } else {
             return false;
@@ -248,16 +318,11 @@ ov::intel_cpu::MLPFusionPass::MLPFusionPass() {
         new_args.push_back(up_proj_w);
         new_args.push_back(down_proj_w);
         if (is_gate_up_quantized_int8) {
-            if (is_gate_up_combined) {
-                new_args.push_back(pattern_map.at(gate_up_proj_weight_scales_per_OC));
-                new_args.push_back(pattern_map.at(gate_up_proj_weight_scales_per_OC));
-            } else {
-                new_args.push_back(pattern_map.at(gate_proj_weight_scales_per_OC));
-                new_args.push_back(pattern_map.at(up_proj_weight_scales_per_OC));
-            }
+            new_args.push_back(gate_proj_scales);
+            new_args.push_back(up_proj_scales);
         }
         if (is_down_proj_int8) {
-            new_args.push_back(pattern_map.at(down_proj_weight_scales_per_OC));
+            new_args.push_back(down_proj_scales);
         }
 
         const auto& old_node = root;
@@ -29,6 +29,7 @@
 #include "openvino/util/pp.hpp"
 #include "transformations/cpu_opset/x64/op/qkv_proj.hpp"
 #include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
+#include "transformations/utils.hpp"
 
 using namespace ov::pass;
 using namespace ov::op;
@@ -47,11 +48,15 @@ ov::intel_cpu::QKVProjFusionPass1::QKVProjFusionPass1() {
     auto q_proj_weight_deq = pattern::wrap_type<v1::Multiply>({q_proj_weight_f32, q_proj_weight_scales_per_OC},
                                                               {{"auto_broadcast", "numpy"}});
 
+    // per OC u8/i8 compressed version (with zero points), converted to the symmetric INT8 per OC (in callback)
+    auto q_proj_weight_int8_compressed = pattern::any_input(is_int8_per_oc_compressed_weights);
+
     auto q_proj_weight_const = pattern::wrap_const();
     auto q_proj_weight_cvt =
         pattern::optional<op::v0::Convert>({q_proj_weight_const}, pattern::type_matches(element::f32));  //  [4096,4096]
-    auto q_proj = pattern::wrap_type<v0::MatMul>({input, q_proj_weight_cvt | q_proj_weight_deq},
-                                                 {{"transpose_a", false}, {"transpose_b", true}});  //  [?,?,4096]
+    auto q_proj =
+        pattern::wrap_type<v0::MatMul>({input, q_proj_weight_cvt | q_proj_weight_deq | q_proj_weight_int8_compressed},
+                                       {{"transpose_a", false}, {"transpose_b", true}});  //  [?,?,4096]
 
     matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
         const auto& pattern_map = m.get_pattern_value_map();
@@ -69,7 +74,33 @@ ov::intel_cpu::QKVProjFusionPass1::QKVProjFusionPass1() {
             return false;
         }
 
-        bool is_quantized_int8 = pattern_map.find(q_proj_weight_const_i8) != pattern_map.end();
+        bool is_quantized_int8 = pattern_map.find(q_proj_weight_const_i8) != pattern_map.end() ||
+                                 pattern_map.find(q_proj_weight_int8_compressed) != pattern_map.end();
+
+        // takes either the symmetrically INT8 quantized weights or the converted compressed ones
+        auto get_int8_weights = [](const Output<Node>& weight,
+                                   std::shared_ptr<op::v0::Constant>& constw,
+                                   std::shared_ptr<op::v0::Constant>& deq_scale) {
+            if (auto deq_mul = ov::as_type_ptr<ov::op::v1::Multiply>(weight.get_node_shared_ptr())) {
+                auto cvt = ov::as_type_ptr<op::v0::Convert>(deq_mul->get_input_node_shared_ptr(0));
+                if (cvt) {
+                    constw = ov::as_type_ptr<op::v0::Constant>(cvt->get_input_node_shared_ptr(0));
+                    deq_scale = ov::as_type_ptr<op::v0::Constant>(deq_mul->get_input_node_shared_ptr(1));
+                    if (constw && constw->get_element_type() == ov::element::i8 && constw->get_shape().size() == 2 &&
+                        deq_scale && deq_scale->get_element_type() == ov::element::f32 &&
+                        deq_scale->get_shape() == ov::Shape{constw->get_shape()[0], 1}) {
+                        return true;
+                    }
+                }
+            }
+            auto converted = convert_to_per_oc_i8(weight);
+            if (!converted) {
+                return false;
+            }
+            constw = converted->weights;
+            deq_scale = converted->scales;
+            return true;
+        };
 
         OutputVector args = {src};
         OutputVector deq_scales;
@@ -92,26 +123,7 @@ ov::intel_cpu::QKVProjFusionPass1::QKVProjFusionPass1() {
             std::shared_ptr<op::v0::Constant> deq_scale;
 
             if (is_quantized_int8) {
-                auto deq_mul = ov::as_type_ptr<ov::op::v1::Multiply>(mm_input1);
-                if (!deq_mul) {
-                    return false;
-                }
-
-                auto deq_mul_in0 = deq_mul->input_value(0).get_node_shared_ptr();
-                auto deq_mul_in1 = deq_mul->input_value(1).get_node_shared_ptr();
-
-                auto cvt = ov::as_type_ptr<op::v0::Convert>(deq_mul_in0);
-                if (!cvt) {
-                    return false;
-                }
-
-                constw = ov::as_type_ptr<op::v0::Constant>(cvt->input_value(0).get_node_shared_ptr());
-                if (!constw || constw->get_element_type() != ov::element::i8) {
-                    return false;
-                }
-
-                deq_scale = ov::as_type_ptr<op::v0::Constant>(deq_mul_in1);
-                if (!deq_scale || deq_scale->get_element_type() != ov::element::f32) {
+                if (!get_int8_weights(mm->input_value(1), constw, deq_scale)) {
                     return false;
                 }
             } else {
@@ -206,8 +218,12 @@ ov::intel_cpu::QKVProjFusionPass2::QKVProjFusionPass2() {
         pattern::wrap_type<ov::op::v1::Multiply>({qkv_proj_weight_f32, qkv_proj_weight_scales_per_OC},
                                                  {{"auto_broadcast", "numpy"}});
 
-    auto qkv_proj = pattern::wrap_type<op::v0::MatMul>({input, qkv_proj_cvt | qkv_proj_weight_deq},
-                                                       {{"transpose_a", false}, {"transpose_b", true}});
+    auto qkv_proj_weight_int8_compressed = pattern::any_input(is_int8_per_oc_compressed_weights);
+
+    auto qkv_proj =
+        pattern::wrap_type<op::v0::MatMul>({input,
+                                            qkv_proj_cvt | qkv_proj_weight_deq | qkv_proj_weight_int8_compressed},
+                                           {{"transpose_a", false}, {"transpose_b", true}});
     auto qkv_split_lengths =
         pattern::wrap_type<op::v0::Constant>(pattern::type_matches(element::i32) && pattern::shape_matches("[3]"));
     auto qkv_split = pattern::wrap_type<ov::op::v1::VariadicSplit>({qkv_proj, 2, qkv_split_lengths});
@@ -235,12 +251,22 @@ ov::intel_cpu::QKVProjFusionPass2::QKVProjFusionPass2() {
             return false;
         }
 
-        bool is_quantized_int8 = pattern_map.find(qkv_proj_weight_const_i8) != pattern_map.end();
+        bool is_quantized_int8 = pattern_map.find(qkv_proj_weight_const_i8) != pattern_map.end() ||
+                                 pattern_map.find(qkv_proj_weight_int8_compressed) != pattern_map.end();
 
         std::shared_ptr<op::v0::Constant> qkv_proj_weight_node;
-        if (is_quantized_int8) {
+        std::shared_ptr<Node> qkv_proj_weight_scales;
+        if (pattern_map.find(qkv_proj_weight_const_i8) != pattern_map.end()) {
             qkv_proj_weight_node =
                 ov::as_type_ptr<op::v0::Constant>(pattern_map.at(qkv_proj_weight_const_i8).get_node_shared_ptr());
+            qkv_proj_weight_scales = pattern_map.at(qkv_proj_weight_scales_per_OC).get_node_shared_ptr();
+        } else if (is_quantized_int8) {
+            auto converted = convert_to_per_oc_i8(pattern_map.at(qkv_proj_weight_int8_compressed));
+            if (!converted) {
+                return false;
+            }
+            qkv_proj_weight_node = converted->weights;
+            qkv_proj_weight_scales = converted->scales;
         } else {
             qkv_proj_weight_node =
                 ov::as_type_ptr<op::v0::Constant>(pattern_map.at(qkv_proj_weight_const).get_node_shared_ptr());
@@ -263,10 +289,9 @@ ov::intel_cpu::QKVProjFusionPass2::QKVProjFusionPass2() {
 
         OutputVector args = {pattern_map.at(input), qkv_proj_weight_node, qkv_proj_weight_node, qkv_proj_weight_node};
         if (is_quantized_int8) {
-            auto scales = pattern_map.at(qkv_proj_weight_scales_per_OC).get_node_shared_ptr();
-            args.emplace_back(scales);
-            args.emplace_back(scales);
-            args.emplace_back(scales);
+            args.emplace_back(qkv_proj_weight_scales);
+            args.emplace_back(qkv_proj_weight_scales);
+            args.emplace_back(qkv_proj_weight_scales);
         }
         auto old_node = root;
         auto new_node = std::make_shared<QKVProjectionNode>(args, config);
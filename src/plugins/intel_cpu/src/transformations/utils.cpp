@@ -4,20 +4,107 @@
 
 #include "utils.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
 #include "ov_ops/fully_connected.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 #include "transformations/utils/utils.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
 
+namespace {
+
+struct WeightsDecompression {
+    std::shared_ptr<ov::op::v0::Constant> weights;
+    std::shared_ptr<ov::op::v0::Constant> zero_points;
+    std::shared_ptr<ov::op::v0::Constant> scales;
+};
+
+std::shared_ptr<ov::op::v0::Constant> get_decompression_constant(const ov::Output<ov::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v0::Convert>(node)) {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    return ov::as_type_ptr<ov::op::v0::Constant>(node);
+}
+
+// scales and zero points are either scalars or given per output channel of the [N, K] weights
+bool is_per_oc(const ov::op::v0::Constant& param, size_t N) {
+    const auto& shape = param.get_shape();
+    return ov::shape_size(shape) == 1 || shape == ov::Shape{N, 1};
+}
+
+std::optional<WeightsDecompression> match_weights_decompression(const ov::Output<ov::Node>& weights) {
+    const auto& out_shape = weights.get_partial_shape();
+    if (!out_shape.is_static() || out_shape.size() != 2) {
+        return std::nullopt;
+    }
+
+    auto node = weights.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v0::Convert>(node)) {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    auto multiply = ov::as_type_ptr<ov::op::v1::Multiply>(node);
+    if (!multiply) {
+        return std::nullopt;
+    }
+
+    WeightsDecompression decompression;
+    decompression.scales = get_decompression_constant(multiply->input_value(1));
+    node = multiply->get_input_node_shared_ptr(0);
+    if (auto subtract = ov::as_type_ptr<ov::op::v1::Subtract>(node)) {
+        decompression.zero_points = get_decompression_constant(subtract->input_value(1));
+        if (!decompression.zero_points) {
+            return std::nullopt;
+        }
+        node = subtract->get_input_node_shared_ptr(0);
+    }
+    if (!decompression.scales || !ov::is_type<ov::op::v0::Convert>(node)) {
+        return std::nullopt;
+    }
+
+    // the group-wise and the 4-bit weights are not matched: the per OC i8 kernels would lose the group scales,
+    // and the weights would take twice the memory
+    decompression.weights = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(0));
+    if (!decompression.weights ||
+        none_of(decompression.weights->get_element_type(), ov::element::u8, ov::element::i8)) {
+        return std::nullopt;
+    }
+
+    const auto& shape = decompression.weights->get_shape();
+    if (shape.size() != 2 || out_shape.to_shape() != shape) {
+        return std::nullopt;
+    }
+    if (!is_per_oc(*decompression.scales, shape[0]) ||
+        (decompression.zero_points && !is_per_oc(*decompression.zero_points, shape[0]))) {
+        return std::nullopt;
+    }
+    return decompression;
+}
+
+}  // namespace
+
 bool has_matmul_with_compressed_weights(const std::shared_ptr<const ov::Model>& model) {
     bool has_decompression_multiply = false;
     auto is_decompression_multiply = [&](ov::Node* node) {
@@ -52,4 +139,68 @@ bool has_matmul_with_compressed_weights(const std::shared_ptr<const ov::Model>&
     return false;
 }
 
+bool is_int8_per_oc_compressed_weights(const ov::Output<ov::Node>& weights) {
+    return match_weights_decompression(weights).has_value();
+}
+
+std::optional<PerOCQuantizedWeights> convert_to_per_oc_i8(const ov::Output<ov::Node>& weights) {
+    const auto decompression = match_weights_decompression(weights);
+    if (!decompression) {
+        return std::nullopt;
+    }
+
+    const auto& shape = decompression->weights->get_shape();
+    const size_t N = shape[0];
+    const size_t K = shape[1];
+    const auto scales = decompression->scales->cast_vector<float>();
+    auto get_scale = [&](size_t n) {
+        return scales.size() == 1 ? scales[0] : scales[n];
+    };
+
+    // the symmetrically quantized i8 weights are taken as is
+    if (decompression->weights->get_element_type() == ov::element::i8 && !decompression->zero_points) {
+        std::vector<float> dst_scales(N);
+        for (size_t n = 0; n < N; n++) {
+            dst_scales[n] = get_scale(n);
+        }
+        return PerOCQuantizedWeights{
+            decompression->weights,
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{N, 1}, dst_scales)};
+    }
+
+    // the weights are shifted by the integer zero points, which keeps the scales and doesn't round the weights again.
+    // The weights which don't fit into i8 after the shift are not converted
+    const auto src = decompression->weights->cast_vector<int16_t>();
+    const auto zero_points =
+        decompression->zero_points ? decompression->zero_points->cast_vector<float>() : std::vector<float>{0.0F};
+    if (std::any_of(zero_points.begin(), zero_points.end(), [](float zp) {
+            return std::nearbyint(zp) != zp;
+        })) {
+        return std::nullopt;
+    }
+
+    std::vector<int8_t> dst(N * K);
+    std::vector<float> dst_scales(N);
+    std::atomic<bool> fits_i8{true};
+    ov::parallel_for(N, [&](size_t n) {
+        const auto zp = static_cast<int16_t>(zero_points.size() == 1 ? zero_points[0] : zero_points[n]);
+        dst_scales[n] = get_scale(n);
+        for (size_t i = n * K; i < (n + 1) * K; i++) {
+            const int w = src[i] - zp;
+            if (w < std::numeric_limits<int8_t>::min() || w > std::numeric_limits<int8_t>::max()) {
+                fits_i8 = false;
+                return;
+            }
+            dst[i] = static_cast<int8_t>(w);
+        }
+    });
+    if (!fits_i8) {
+        return std::nullopt;
+    }
+
+    return PerOCQuantizedWeights{
+        std::make_shared<ov::op::v0::Constant>(ov::element::i8, ov::Shape{N, K}, dst),
+        std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{N, 1}, dst_scales)};
+}
+
 }  // namespace ov::intel_cpu
@@ -5,11 +5,31 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "openvino/core/model.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/op/constant.hpp"
 
 namespace ov::intel_cpu {
 
 bool has_matmul_with_compressed_weights(const std::shared_ptr<const ov::Model>& model);
 
+struct PerOCQuantizedWeights {
+    std::shared_ptr<ov::op::v0::Constant> weights;  // i8 [N, K]
+    std::shared_ptr<ov::op::v0::Constant> scales;   // f32 [N, 1]
+};
+
+// Checks if the output is the decompression subgraph of [N, K] weights compressed to u8/i8 with per output channel
+// scales and optional zero points:
+//   Constant -> Convert -> [Subtract(zero points)] -> Multiply(scales) -> [Convert]
+bool is_int8_per_oc_compressed_weights(const ov::Output<ov::Node>& weights);
+
+// Converts the compressed weights matched by is_int8_per_oc_compressed_weights() to symmetric per output channel i8,
+// which is the weights format of the INT8 AMX kernels of the fused LLM nodes. The zero points are subtracted from the
+// weights exactly, so std::nullopt is returned if the shifted weights don't fit into i8 or a zero point isn't integer.
+// The group-wise and 4-bit weights are not supported: the kernels apply a single scale per output channel after the
+// whole K reduction.
+std::optional<PerOCQuantizedWeights> convert_to_per_oc_i8(const ov::Output<ov::Node>& weights);
+
 }  // namespace ov::intel_cpu
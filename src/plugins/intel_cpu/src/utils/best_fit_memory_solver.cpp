@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "best_fit_memory_solver.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+int sizeClass(int64_t size) {
+    int result = 0;
+    while (size > 1) {
+        size >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+}  // namespace
+
+BestFitMemorySolver::BestFitMemorySolver(std::vector<Box> boxes) : m_boxes(std::move(boxes)) {
+    ov::MemorySolver::normalize_boxes(m_boxes);
+}
+
+int64_t BestFitMemorySolver::solve() {
+    std::vector<const Box*> order;
+    order.reserve(m_boxes.size());
+    for (const auto& box : m_boxes) {
+        order.push_back(&box);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Box* l, const Box* r) {
+        const auto lClass = sizeClass(l->size);
+        const auto rClass = sizeClass(r->size);
+        if (lClass != rClass) {
+            return lClass > rClass;
+        }
+        const auto lLifetime = l->finish - l->start;
+        const auto rLifetime = r->finish - r->start;
+        if (lLifetime != rLifetime) {
+            return lLifetime > rLifetime;
+        }
+        return l->size > r->size;
+    });
+
+    struct Placement {
+        const Box* box;
+        int64_t offset;
+    };
+    std::vector<Placement> placed;
+    placed.reserve(order.size());
+    std::vector<Placement> alive;
+
+    m_offsets.clear();
+    int64_t arenaSize = 0;
+    for (const auto* box : order) {
+        alive.clear();
+        for (const auto& item : placed) {
+            if (item.box->start <= box->finish && box->start <= item.box->finish) {
+                alive.push_back(item);
+            }
+        }
+        std::sort(alive.begin(), alive.end(), [](const Placement& l, const Placement& r) {
+            return l.offset < r.offset;
+        });
+
+        int64_t bestOffset = -1;
+        int64_t bestGap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (const auto& item : alive) {
+            const auto gap = item.offset - top;
+            if (gap >= box->size && gap < bestGap) {
+                bestGap = gap;
+                bestOffset = top;
+            }
+            top = std::max(top, item.offset + item.box->size);
+        }
+        if (bestOffset < 0) {
+            bestOffset = top;
+        }
+
+        placed.push_back({box, bestOffset});
+        m_offsets[box->id] = bestOffset;
+        arenaSize = std::max(arenaSize, bestOffset + box->size);
+    }
+
+    return arenaSize;
+}
+
+int64_t BestFitMemorySolver::getOffset(int64_t id) const {
+    auto itr = m_offsets.find(id);
+    OPENVINO_ASSERT(itr != m_offsets.end(), "There is no box with id ", id);
+    return itr->second;
+}
+
+int64_t BestFitMemorySolver::getLowerBound() const {
+    // the boxes are sorted by start after normalization, so it is enough to retire the boxes finished before each start
+    std::multimap<int, int64_t> finishes;
+    int64_t current = 0;
+    int64_t result = 0;
+    for (const auto& box : m_boxes) {
+        while (!finishes.empty() && finishes.begin()->first < box.start) {
+            current -= finishes.begin()->second;
+            finishes.erase(finishes.begin());
+        }
+        current += box.size;
+        finishes.emplace(box.finish, box.size);
+        result = std::max(result, current);
+    }
+    return result;
+}
+
+}  // namespace ov::intel_cpu
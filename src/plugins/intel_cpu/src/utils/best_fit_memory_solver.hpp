@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Solves the same problem as ov::MemorySolver (places the boxes with intersecting lifetimes to non intersecting
+ * memory ranges), but uses the best-fit interval packing.
+ *
+ * The boxes are processed by size classes (powers of two) in descending order, and within a size class the boxes with
+ * longer lifetimes go first, since they constrain the placement of the others the most. Each box is put into the
+ * smallest gap between the already placed boxes alive at the same time, or on top of them if no gap fits. Compared to
+ * the first-fit placement this leaves the big gaps for the big boxes and usually gives a smaller arena, although none
+ * of the heuristics wins on all the graphs.
+ */
+class BestFitMemorySolver {
+public:
+    using Box = ov::MemorySolver::Box;
+
+    explicit BestFitMemorySolver(std::vector<Box> boxes);
+
+    /**
+     * @brief Places the boxes
+     * @return size of the memory arena required to store all the boxes
+     */
+    int64_t solve();
+
+    /**
+     * @brief Provides the calculated offset of the box
+     */
+    [[nodiscard]] int64_t getOffset(int64_t id) const;
+
+    /**
+     * @brief The maximum of the total size of the boxes alive at the same time, which is the lower bound of the arena
+     * size any solver may achieve
+     */
+    [[nodiscard]] int64_t getLowerBound() const;
+
+private:
+    std::vector<Box> m_boxes;
+    std::unordered_map<int64_t, int64_t> m_offsets;
+};
+
+}  // namespace ov::intel_cpu
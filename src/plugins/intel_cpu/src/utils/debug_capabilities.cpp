@@ -720,6 +720,7 @@ std::ostream& operator<<(std::ostream& os, const MemoryStatisticsRecord& record)
     os << "Total size: " << record.total_size << " bytes\n";
     os << "Optimal total size: " << record.optimal_total_size << " bytes\n";
     os << "Max region size: " << record.max_region_size << " bytes\n";
+    os << "Fragmentation: " << record.fragmentation() << " %\n";
     return os;
 }
 
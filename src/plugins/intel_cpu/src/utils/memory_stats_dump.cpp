@@ -70,11 +70,12 @@ static void dumpStatisticsCSV(std::ofstream& os,
         for (auto&& stat : statistics) {
             os << "Memory control ID: " << stat.first << ";;;;;;\n";
             os << "Record name;Total regions [-];Total unique blocks [-];Total size [bytes];Optimal total size "
-                  "[bytes];Max region size [bytes]\n";
+                  "[bytes];Max region size [bytes];Fragmentation [%]\n";
 
             for (auto&& item : stat.second) {
                 os << item.id << ";" << item.total_regions << ";" << item.total_unique_blocks << ";" << item.total_size
-                   << ";" << item.optimal_total_size << ";" << item.max_region_size << ";\n";
+                   << ";" << item.optimal_total_size << ";" << item.max_region_size << ";" << item.fragmentation()
+                   << ";\n";
             }
         }
         os << ";;;;;;\n";
@@ -4,10 +4,14 @@
 
 #include "serialize.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <istream>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -16,8 +20,13 @@
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
@@ -26,6 +35,49 @@
 
 namespace ov::intel_cpu {
 
+namespace {
+
+bool hasSubnormalsOrBf16Overflows(const std::shared_ptr<ov::op::v0::Constant>& constant) {
+    const size_t size = shape_size(constant->get_shape());
+    const auto* u32data = constant->get_data_ptr<uint32_t>();
+    const auto* f32data = constant->get_data_ptr<float>();
+    const float bf16_max = std::numeric_limits<ov::bfloat16>::max();
+    constexpr uint32_t mantissaMask = 0x007fffff;
+    constexpr uint32_t exponentMask = 0x7f800000;
+    constexpr size_t batch_size = 2048;
+
+    std::atomic<bool> found(false);
+    parallel_for((size + batch_size - 1) / batch_size, [&](size_t n) {
+        const size_t end = std::min(size, (n + 1) * batch_size);
+        for (size_t i = n * batch_size; i < end && !found; ++i) {
+            if (((u32data[i] & exponentMask) == 0 && (u32data[i] & mantissaMask) != 0) || f32data[i] < -bf16_max ||
+                f32data[i] > bf16_max) {
+                found = true;
+            }
+        }
+    });
+    return found;
+}
+
+bool hasSubnormalsOrBf16Overflows(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            if (constant->get_element_type() == ov::element::f32 && hasSubnormalsOrBf16Overflows(constant)) {
+                return true;
+            }
+        } else if (const auto subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : subgraph->get_functions()) {
+                if (hasSubnormalsOrBf16Overflows(body)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 ////////// ModelSerializer //////////
 
 ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn)
@@ -40,7 +92,11 @@ ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encr
           encrypt_fn) {};
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
-    run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
+    auto cloned_model = model->clone();
+    // The constants are checked once on export, so the import doesn't need to read all the (possibly memory-mapped)
+    // weights just to find out that there is nothing to flush or saturate.
+    cloned_model->set_rt_info(!hasSubnormalsOrBf16Overflows(cloned_model), "intel_cpu", "constants_verified");
+    run_on_model(cloned_model);
 }
 
 bool ModelSerializer::use_absolute_offset() {
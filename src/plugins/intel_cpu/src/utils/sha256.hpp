@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief SHA-256 digest (FIPS 180-4) of the data identified across the processes, where a collision of a 64-bit hash
+ * would silently substitute the data of another model
+ */
+class Sha256 {
+public:
+    using Digest = std::array<uint8_t, 32>;
+
+    Sha256() = default;
+
+    void update(const void* data, size_t size);
+
+    /**
+     * @brief Pads the data and returns the digest, the object must not be updated afterwards
+     */
+    Digest finalize();
+
+    static Digest digest(const void* data, size_t size);
+
+    static std::string toHex(const Digest& digest);
+
+private:
+    void processBlock(const uint8_t* block);
+
+    std::array<uint32_t, 8> m_state{0x6a09e667,
+                                    0xbb67ae85,
+                                    0x3c6ef372,
+                                    0xa54ff53a,
+                                    0x510e527f,
+                                    0x9b05688c,
+                                    0x1f83d9ab,
+                                    0x5be0cd19};
+    std::array<uint8_t, 64> m_block{};
+    size_t m_blockSize = 0;
+    uint64_t m_totalSize = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -5,19 +5,25 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "shared_weights_storage.hpp"
 
 namespace ov::intel_cpu {
 
+WeightsSharing::WeightsSharing(SharedWeightsStorage::Ptr sharedStorage) : sharedStorage(std::move(sharedStorage)) {}
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -71,6 +77,19 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
                                           newPtr);
 }
 
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
+                                                               const std::function<MemoryPtr(void)>& create,
+                                                               const std::function<std::string(void)>& getStorageKey,
+                                                               const dnnl::engine& eng,
+                                                               const MemoryDescPtr& desc) {
+    if (!sharedStorage) {
+        return findOrCreate(key, create);
+    }
+    return findOrCreate(key, [&]() {
+        return sharedStorage->findOrCreate(getStorageKey(), eng, desc, create);
+    });
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -91,10 +110,15 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+SocketsWeights::SocketsWeights(const std::string& sharedWeightsDir,
+                               bool sharedWeightsPersistent,
+                               uint64_t sharedWeightsMaxSize) {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] = std::make_shared<WeightsSharing>(SharedWeightsStorage::create(sharedWeightsDir,
+                                                                                              socket_id,
+                                                                                              sharedWeightsPersistent,
+                                                                                              sharedWeightsMaxSize));
     }
 }
 
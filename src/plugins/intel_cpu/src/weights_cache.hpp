@@ -6,16 +6,20 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "shared_weights_storage.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -51,6 +55,11 @@ public:
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    /**
+     * @param sharedStorage is an optional storage to share the memory with other processes
+     */
+    explicit WeightsSharing(SharedWeightsStorage::Ptr sharedStorage = nullptr);
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -71,6 +80,25 @@ public:
                                    const std::function<MemoryPtr(void)>& create,
                                    bool valid = true);
 
+    /**
+     * @brief Same as findOrCreate, but if the cross-process storage is attached, the memory missing in the process is
+     * looked up in the storage first, and the newly created memory is published to it. So the memory must be complete
+     * and immutable once created.
+     * @param getStorageKey returns the key identifying the memory content in all the processes, it is called only if
+     * the memory is not found in the process
+     * @param eng is the engine the memory is bound to
+     * @param desc is the descriptor of the memory
+     */
+    SharedMemory::Ptr findOrCreate(const std::string& key,
+                                   const std::function<MemoryPtr(void)>& create,
+                                   const std::function<std::string(void)>& getStorageKey,
+                                   const dnnl::engine& eng,
+                                   const MemoryDescPtr& desc);
+
+    [[nodiscard]] bool hasSharedStorage() const {
+        return static_cast<bool>(sharedStorage);
+    }
+
     SharedMemory::Ptr get(const std::string& key) const;
 
 #ifdef CPU_DEBUG_CAPS
@@ -80,6 +108,7 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    SharedWeightsStorage::Ptr sharedStorage;
 };
 
 /**
@@ -89,7 +118,14 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    /**
+     * @param sharedWeightsDir is the directory to share the weights with other processes, empty to keep them private
+     * @param sharedWeightsPersistent keeps the shared weights in the directory after the last process releases them
+     * @param sharedWeightsMaxSize is the size bound of the persistent directory in bytes, 0 for the default one
+     */
+    explicit SocketsWeights(const std::string& sharedWeightsDir = {},
+                            bool sharedWeightsPersistent = false,
+                            uint64_t sharedWeightsMaxSize = 0);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
@@ -0,0 +1,479 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Micro-benchmark of the CPU PagedAttention executor on the synthetic continuous batching steps.
+//
+// Every step mixes the prefill sequences (the prompts or their chunks) and the decoding sequences (one new token each)
+// sharing one paged KV cache. The blocks of the cache are assigned to the sequences in the random order to simulate the
+// fragmented cache of a long running server, the past tokens of the sequences are written to the cache by the
+// executor itself before the measurement, so the quantized caches hold the valid scales and zero points.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_shape.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/kernels/scaled_attn/executor_pa.hpp"
+#include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/general_utils.h"
+#include "utils/precision_support.h"
+
+using namespace ov::intel_cpu;
+using namespace ov::Extensions::Cpu;
+
+namespace {
+
+// the only block size supported by the CPU PagedAttention
+constexpr size_t block_size = 32;
+
+struct BenchmarkOptions {
+    std::vector<ov::element::Type> data_types{ov::element::f32, ov::element::bf16, ov::element::f16};
+    // dynamic means the cache of the data type
+    std::vector<ov::element::Type> cache_types{ov::element::dynamic, ov::element::u8, ov::element::u4};
+    size_t heads = 32;
+    size_t kv_heads = 8;
+    size_t head_size = 128;
+    size_t prefill_seqs = 1;
+    size_t prefill_len = 1024;
+    size_t prefill_past = 0;
+    size_t decode_seqs = 31;
+    size_t decode_past = 2048;
+    size_t threads = 0;
+    size_t warmup = 3;
+    size_t iterations = 20;
+    bool key_by_channel = false;
+    float xattention_threshold = 0.0F;
+    int32_t xattention_block_size = 128;
+    int32_t xattention_stride = 8;
+    uint32_t seed = 1;
+};
+
+void print_help() {
+    std::cout << "Usage: ov_cpu_paged_attn_benchmark [--option=value ...]\n"
+                 "  --data_types=f32,bf16,f16      precisions of the query and output\n"
+                 "  --cache_types=native,u8,u4     precisions of the KV cache, native is the data precision\n"
+                 "  --heads=32 --kv_heads=8 --head_size=128\n"
+                 "  --prefill_seqs=1 --prefill_len=1024 --prefill_past=0\n"
+                 "                                 prefill sequences, prefill_past > 0 gives the prompt chunks\n"
+                 "  --decode_seqs=31 --decode_past=2048\n"
+                 "                                 decoding sequences generating one token per step\n"
+                 "  --threads=0                    threads number, 0 is all the available threads\n"
+                 "  --warmup=3 --iterations=20\n"
+                 "  --key_by_channel               quantize the integral key cache by channel\n"
+                 "  --xattention_threshold=0       block-sparse prefill threshold, 0 keeps the prefill dense\n"
+                 "  --xattention_block_size=128 --xattention_stride=8\n"
+                 "  --seed=1\n";
+}
+
+std::vector<ov::element::Type> parse_types(const std::string& value) {
+    std::vector<ov::element::Type> types;
+    std::stringstream stream(value);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        types.emplace_back(name == "native" ? ov::element::dynamic : ov::element::Type(name));
+    }
+    return types;
+}
+
+BenchmarkOptions parse_options(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const auto eq = arg.find('=');
+        const auto key = arg.substr(0, eq);
+        const auto value = eq == std::string::npos ? std::string{} : arg.substr(eq + 1);
+        auto as_size = [&]() {
+            return static_cast<size_t>(std::stoull(value));
+        };
+        if (key == "--help" || key == "-h") {
+            print_help();
+            std::exit(EXIT_SUCCESS);
+        } else if (key == "--data_types") {
+            options.data_types = parse_types(value);
+        } else if (key == "--cache_types") {
+            options.cache_types = parse_types(value);
+        } else if (key == "--heads") {
+            options.heads = as_size();
+        } else if (key == "--kv_heads") {
+            options.kv_heads = as_size();
+        } else if (key == "--head_size") {
+            options.head_size = as_size();
+        } else if (key == "--prefill_seqs") {
+            options.prefill_seqs = as_size();
+        } else if (key == "--prefill_len") {
+            options.prefill_len = as_size();
+        } else if (key == "--prefill_past") {
+            options.prefill_past = as_size();
+        } else if (key == "--decode_seqs") {
+            options.decode_seqs = as_size();
+        } else if (key == "--decode_past") {
+            options.decode_past = as_size();
+        } else if (key == "--threads") {
+            options.threads = as_size();
+        } else if (key == "--warmup") {
+            options.warmup = as_size();
+        } else if (key == "--iterations") {
+            options.iterations = as_size();
+        } else if (key == "--key_by_channel") {
+            options.key_by_channel = true;
+        } else if (key == "--xattention_threshold") {
+            options.xattention_threshold = std::stof(value);
+        } else if (key == "--xattention_block_size") {
+            options.xattention_block_size = std::stoi(value);
+        } else if (key == "--xattention_stride") {
+            options.xattention_stride = std::stoi(value);
+        } else if (key == "--seed") {
+            options.seed = static_cast<uint32_t>(std::stoul(value));
+        } else {
+            OPENVINO_THROW("Unknown option: ", arg);
+        }
+    }
+    OPENVINO_ASSERT(options.heads % options.kv_heads == 0, "heads must be a multiple of kv_heads");
+    OPENVINO_ASSERT(options.prefill_seqs + options.decode_seqs > 0, "the step has no sequences");
+    OPENVINO_ASSERT(options.prefill_seqs == 0 || options.prefill_len > 1, "prefill_len must be greater than 1");
+    OPENVINO_ASSERT(options.iterations > 0, "iterations must be positive");
+    return options;
+}
+
+MemoryPtr create_memory(ov::element::Type precision, const VectorDims& dims) {
+    static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    return std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(dims)));
+}
+
+template <typename T>
+MemoryPtr create_scalar(ov::element::Type precision, T value) {
+    auto memory = create_memory(precision, {});
+    *memory->getDataAs<T>() = value;
+    return memory;
+}
+
+MemoryPtr create_i32(const std::vector<int32_t>& values) {
+    auto memory = create_memory(ov::element::i32, {values.size()});
+    std::copy(values.begin(), values.end(), memory->getDataAs<int32_t>());
+    return memory;
+}
+
+template <typename T>
+void fill_uniform(T* data, size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> distribution(-1.0F, 1.0F);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<T>(distribution(gen));
+    }
+}
+
+MemoryPtr create_random(ov::element::Type precision, const VectorDims& dims, std::mt19937& gen) {
+    auto memory = create_memory(precision, dims);
+    const auto size = memory->getShape().getElementsCount();
+    if (precision == ov::element::f32) {
+        fill_uniform(memory->getDataAs<float>(), size, gen);
+    } else if (precision == ov::element::bf16) {
+        fill_uniform(memory->getDataAs<ov::bfloat16>(), size, gen);
+    } else if (precision == ov::element::f16) {
+        fill_uniform(memory->getDataAs<ov::float16>(), size, gen);
+    } else {
+        OPENVINO_THROW("Unsupported data precision: ", precision);
+    }
+    return memory;
+}
+
+// the sequences of one continuous batching step
+struct StepLayout {
+    std::vector<int32_t> past_lens;
+    std::vector<int32_t> q_lens;
+    std::vector<int32_t> subsequence_begins{0};
+    std::vector<int32_t> block_indices;
+    std::vector<int32_t> block_indices_begins{0};
+    int32_t max_context_len = 0;
+
+    [[nodiscard]] size_t tokens() const {
+        return static_cast<size_t>(subsequence_begins.back());
+    }
+};
+
+// the block tables are shared by the steps, so the past tokens written by the first step are seen by the second one
+StepLayout make_layout(const std::vector<int32_t>& past_lens,
+                       const std::vector<int32_t>& q_lens,
+                       const std::vector<int32_t>& blocks) {
+    StepLayout layout;
+    for (size_t i = 0; i < past_lens.size(); i++) {
+        const auto kv_len = past_lens[i] + q_lens[i];
+        if (q_lens[i] == 0) {
+            // the sequence without the past tokens is skipped by the cache filling step
+            continue;
+        }
+        const auto begin = layout.block_indices_begins.back();
+        layout.past_lens.push_back(past_lens[i]);
+        layout.q_lens.push_back(q_lens[i]);
+        layout.subsequence_begins.push_back(layout.subsequence_begins.back() + q_lens[i]);
+        layout.block_indices_begins.push_back(begin + static_cast<int32_t>(div_up(kv_len, block_size)));
+        layout.block_indices.insert(layout.block_indices.end(),
+                                    blocks.begin() + begin,
+                                    blocks.begin() + layout.block_indices_begins.back());
+        layout.max_context_len = std::max(layout.max_context_len, kv_len);
+    }
+    return layout;
+}
+
+struct Workload {
+    StepLayout fill;  // writes the past tokens to the cache
+    StepLayout step;  // the measured step
+    size_t blocks = 0;
+};
+
+Workload make_workload(const BenchmarkOptions& options, std::mt19937& gen) {
+    std::vector<int32_t> past_lens;
+    std::vector<int32_t> q_lens;
+    for (size_t i = 0; i < options.prefill_seqs; i++) {
+        past_lens.push_back(static_cast<int32_t>(options.prefill_past));
+        q_lens.push_back(static_cast<int32_t>(options.prefill_len));
+    }
+    for (size_t i = 0; i < options.decode_seqs; i++) {
+        past_lens.push_back(static_cast<int32_t>(options.decode_past));
+        q_lens.push_back(1);
+    }
+
+    Workload workload;
+    for (size_t i = 0; i < past_lens.size(); i++) {
+        workload.blocks += div_up(static_cast<size_t>(past_lens[i] + q_lens[i]), block_size);
+    }
+    std::vector<int32_t> blocks(workload.blocks);
+    std::iota(blocks.begin(), blocks.end(), 0);
+    std::shuffle(blocks.begin(), blocks.end(), gen);
+
+    // the sequences keep the blocks of the full step while the past tokens are written
+    std::vector<int32_t> seq_blocks;
+    size_t offset = 0;
+    std::vector<int32_t> fill_past(past_lens.size(), 0);
+    for (size_t i = 0; i < past_lens.size(); i++) {
+        const auto count = div_up(static_cast<size_t>(past_lens[i] + q_lens[i]), block_size);
+        const auto past_count = div_up(static_cast<size_t>(past_lens[i]), block_size);
+        seq_blocks.insert(seq_blocks.end(), blocks.begin() + offset, blocks.begin() + offset + past_count);
+        offset += count;
+    }
+    workload.fill = make_layout(fill_past, past_lens, seq_blocks);
+    workload.step = make_layout(past_lens, q_lens, blocks);
+    return workload;
+}
+
+struct CacheLayout {
+    VectorDims key_dims;
+    VectorDims value_dims;
+};
+
+CacheLayout make_cache_layout(const BenchmarkOptions& options,
+                              ov::element::Type key_type,
+                              ov::element::Type value_type,
+                              size_t blocks) {
+    const auto S = options.head_size;
+    // scale and zero point of every group
+    auto params_size = [](ov::element::Type type) {
+        return type.is_integral() ? 2 * sizeof(float) * (type.bitwidth() < 8 ? 8 / type.bitwidth() : 1) : 0;
+    };
+    CacheLayout layout;
+    if (options.key_by_channel && key_type.is_integral()) {
+        layout.key_dims = {blocks, options.kv_heads, block_size + params_size(key_type), S};
+    } else {
+        layout.key_dims = {blocks, options.kv_heads, block_size, S + params_size(key_type)};
+    }
+    layout.value_dims = {blocks, options.kv_heads, block_size, S + params_size(value_type)};
+    return layout;
+}
+
+std::vector<MemoryPtr> make_inputs(const BenchmarkOptions& options,
+                                   const StepLayout& layout,
+                                   ov::element::Type data_type,
+                                   const MemoryPtr& key_cache,
+                                   const MemoryPtr& value_cache,
+                                   std::mt19937& gen) {
+    const auto tokens = layout.tokens();
+    const auto S = options.head_size;
+    std::vector<MemoryPtr> inputs(20);
+    inputs[PagedAttentionExecutor::ID_Q] = create_random(data_type, {tokens, options.heads * S}, gen);
+    inputs[PagedAttentionExecutor::ID_K] = create_random(data_type, {tokens, options.kv_heads * S}, gen);
+    inputs[PagedAttentionExecutor::ID_V] = create_random(data_type, {tokens, options.kv_heads * S}, gen);
+    inputs[PagedAttentionExecutor::ID_KCACHE] = key_cache;
+    inputs[PagedAttentionExecutor::ID_VCACHE] = value_cache;
+    inputs[PagedAttentionExecutor::ID_PAST_LENS] = create_i32(layout.past_lens);
+    inputs[PagedAttentionExecutor::ID_SUBSEQUENCE_BEGINS] = create_i32(layout.subsequence_begins);
+    inputs[PagedAttentionExecutor::ID_BLOCK_INDICES] = create_i32(layout.block_indices);
+    inputs[PagedAttentionExecutor::ID_BLOCK_INDICES_BEGINS] = create_i32(layout.block_indices_begins);
+    inputs[PagedAttentionExecutor::ID_SCALE] = create_scalar(ov::element::f32, 0.0F);
+    inputs[PagedAttentionExecutor::ID_SLIDING_WINDOW] = create_scalar(ov::element::i32, int32_t{0});
+    inputs[PagedAttentionExecutor::ID_ALIBI_SLOPES] = create_memory(ov::element::f32, {0});
+    inputs[PagedAttentionExecutor::ID_MAX_CONTEXT_LEN] = create_scalar(ov::element::i32, layout.max_context_len);
+    inputs[PagedAttentionExecutor::ID_SCORE_AGGREGATION_WINDOW] = create_memory(ov::element::i32, {0});
+    inputs[PagedAttentionExecutor::ID_ROTATED_BLOCK_INDICES] = create_memory(ov::element::i32, {0});
+    inputs[PagedAttentionExecutor::ID_ROTATION_DELTAS] = create_memory(ov::element::i32, {0});
+    inputs[PagedAttentionExecutor::ID_ROTATION_TRIG_LUT] = create_memory(ov::element::f32, {0});
+    if (options.xattention_threshold > 0.0F) {
+        auto threshold = create_memory(ov::element::f32, {layout.past_lens.size()});
+        std::fill_n(threshold->getDataAs<float>(), layout.past_lens.size(), options.xattention_threshold);
+        inputs[PagedAttentionExecutor::ID_XATTENTION_THRESHOLD] = threshold;
+    } else {
+        inputs[PagedAttentionExecutor::ID_XATTENTION_THRESHOLD] = create_memory(ov::element::f32, {0});
+    }
+    inputs[PagedAttentionExecutor::ID_XATTENTION_BLOCK_SIZE] =
+        create_scalar(ov::element::i32, options.xattention_block_size);
+    inputs[PagedAttentionExecutor::ID_XATTENTION_STRIDE] = create_scalar(ov::element::i32, options.xattention_stride);
+    return inputs;
+}
+
+std::string describe(const BenchmarkOptions& options) {
+    std::ostringstream result;
+    result << "heads " << options.heads << "/" << options.kv_heads << " x " << options.head_size << ", ";
+    if (options.prefill_seqs) {
+        result << options.prefill_seqs << " prefill x " << options.prefill_len << " (past " << options.prefill_past
+               << "), ";
+    }
+    if (options.decode_seqs) {
+        result << options.decode_seqs << " decode (past " << options.decode_past << "), ";
+    }
+    result << "threads " << parallel_get_max_threads();
+    return result.str();
+}
+
+void run_config(const BenchmarkOptions& options, ov::element::Type data_type, ov::element::Type cache_type) {
+    const auto key_type = cache_type == ov::element::dynamic ? data_type : cache_type;
+    const auto value_type = key_type;
+    std::cout << "data " << data_type << ", kv cache " << key_type << (options.key_by_channel ? " (by channel)" : "")
+              << ": ";
+    if (!hasHardwareSupport(data_type)) {
+        std::cout << "skipped, no hardware support\n";
+        return;
+    }
+
+    std::shared_ptr<PagedAttentionExecutor> executor;
+    try {
+        PagedAttnQuantParams params;
+        params.quant_key_bychannel = options.key_by_channel && key_type.is_integral();
+        executor = ov::Extensions::Cpu::XARCH::make_pa_executor(data_type, key_type, value_type, params);
+    } catch (const ov::Exception& e) {
+        std::cout << "skipped, " << e.what() << "\n";
+        return;
+    }
+    if (!executor) {
+        std::cout << "skipped, no executor\n";
+        return;
+    }
+
+    std::mt19937 gen(options.seed);
+    const auto workload = make_workload(options, gen);
+    const auto cache_layout = make_cache_layout(options, key_type, value_type, workload.blocks);
+    auto key_cache = create_memory(key_type, cache_layout.key_dims);
+    auto value_cache = create_memory(value_type, cache_layout.value_dims);
+    std::memset(key_cache->getData(), 0, key_cache->getSize());
+    std::memset(value_cache->getData(), 0, value_cache->getSize());
+
+    const auto& step = workload.step;
+    const auto H = options.heads;
+    const auto S = options.head_size;
+    if (workload.fill.tokens() > 0) {
+        auto fill_inputs = make_inputs(options, workload.fill, data_type, key_cache, value_cache, gen);
+        fill_inputs[PagedAttentionExecutor::ID_XATTENTION_THRESHOLD] = create_memory(ov::element::f32, {0});
+        executor->execute(fill_inputs, {create_memory(data_type, {workload.fill.tokens(), H * S})});
+    }
+    const auto inputs = make_inputs(options, step, data_type, key_cache, value_cache, gen);
+    const std::vector<MemoryPtr> outputs{create_memory(data_type, {step.tokens(), H * S})};
+
+    for (size_t i = 0; i < options.warmup; i++) {
+        executor->execute(inputs, outputs);
+    }
+    PagedAttnProfiler profiler(static_cast<size_t>(parallel_get_max_threads()));
+    double total_ms = 0.0;
+    double min_ms = 0.0;
+    for (size_t i = 0; i < options.iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        executor->execute(inputs, outputs);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        total_ms += elapsed.count();
+        min_ms = i == 0 ? elapsed.count() : std::min(min_ms, elapsed.count());
+    }
+    // the phases are measured by the separate runs, the timers perturb the short kernels of the decoding
+    executor->set_profiler(&profiler);
+    for (size_t i = 0; i < options.iterations; i++) {
+        executor->execute(inputs, outputs);
+    }
+    executor->set_profiler(nullptr);
+
+    const auto mean_ms = total_ms / static_cast<double>(options.iterations);
+    // every block of the cache is read at least once by the step, the inputs are read and the output is written once
+    size_t bytes = key_cache->getSize() + value_cache->getSize() + outputs[0]->getSize();
+    for (auto id : {PagedAttentionExecutor::ID_Q, PagedAttentionExecutor::ID_K, PagedAttentionExecutor::ID_V}) {
+        bytes += inputs[id]->getSize();
+    }
+    std::cout << describe(options) << "\n"
+              << std::fixed << std::setprecision(3) << "  latency " << mean_ms << " ms/step (min " << min_ms
+              << "), throughput " << std::setprecision(1)
+              << static_cast<double>(step.tokens()) * 1e3 / mean_ms << " tokens/s, bandwidth "
+              << static_cast<double>(bytes) * 1e-6 / mean_ms << " GB/s\n";
+
+    // the phase times are summed over the threads, divided by the threads number they are comparable to the latency
+    const auto runs = static_cast<double>(profiler.get_threads_num() * options.iterations);
+    double phases_ms = 0.0;
+    for (size_t i = 0; i < PagedAttnProfiler::PHASE_COUNT; i++) {
+        const auto phase = static_cast<PagedAttnProfiler::Phase>(i);
+        const auto phase_ms = profiler.get_ms(phase) / runs;
+        phases_ms += phase_ms;
+        std::cout << "  " << std::left << std::setw(10) << PagedAttnProfiler::get_name(phase) << std::right
+                  << std::setprecision(3) << std::setw(10) << phase_ms << " ms" << std::setprecision(1)
+                  << std::setw(7) << phase_ms * 100.0 / mean_ms << " %\n";
+    }
+    const auto other_ms = std::max(mean_ms - phases_ms, 0.0);
+    std::cout << "  " << std::left << std::setw(10) << "other" << std::right << std::setprecision(3) << std::setw(10)
+              << other_ms << " ms" << std::setprecision(1) << std::setw(7) << other_ms * 100.0 / mean_ms << " %\n";
+}
+
+template <typename F>
+void run_with_threads(size_t threads, const F& func) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    if (threads) {
+        tbb::task_arena arena(static_cast<int>(threads));
+        arena.execute(func);
+        return;
+    }
+#elif OV_THREAD == OV_THREAD_OMP
+    if (threads) {
+        parallel_set_num_threads(static_cast<int>(threads));
+    }
+#endif
+    func();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        const auto options = parse_options(argc, argv);
+        run_with_threads(options.threads, [&]() {
+            for (const auto& data_type : options.data_types) {
+                for (const auto& cache_type : options.cache_types) {
+                    run_config(options, data_type, cache_type);
+                }
+            }
+        });
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -6,6 +6,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
@@ -41,6 +43,7 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::hint::enable_cpu_pinning.name()),
         RO_property(ov::hint::enable_cpu_reservation.name()),
         RO_property(ov::hint::scheduling_core_type.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::hint::model_distribution_policy.name()),
         RO_property(ov::hint::enable_hyper_threading.name()),
         RO_property(ov::execution_devices.name()),
@@ -541,4 +544,37 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuModelDistributionPolicyTensorParallel) {
     ASSERT_EQ(enable_tensor_parallel, true);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkModelPriorityReportsQueueWait) {
+    ov::Core core;
+    std::shared_ptr<ov::Model> model = ov::test::utils::make_matmul_bias();
+    auto hasQueueWait = [&](bool enableProfiling) {
+        ov::CompiledModel compiledModel = core.compile_model(model,
+                                                             deviceName,
+                                                             ov::hint::model_priority(ov::hint::Priority::HIGH),
+                                                             ov::enable_profiling(enableProfiling),
+                                                             ov::num_streams(2));
+        EXPECT_EQ(compiledModel.get_property(ov::hint::model_priority), ov::hint::Priority::HIGH);
+        auto request = compiledModel.create_infer_request();
+        request.start_async();
+        request.wait();
+        const auto perf = request.get_profiling_info();
+        return std::any_of(perf.begin(), perf.end(), [](const ov::ProfilingInfo& info) {
+            return info.node_type == "QueueWait" && info.exec_type == "priority_2";
+        });
+    };
+
+    ASSERT_TRUE(hasQueueWait(true));
+    ASSERT_FALSE(hasQueueWait(false));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkModelPriorityWithWorkStealingThrows) {
+    ov::Core core;
+    std::shared_ptr<ov::Model> model = ov::test::utils::make_matmul_bias();
+    ASSERT_THROW(core.compile_model(model,
+                                    deviceName,
+                                    ov::hint::model_priority(ov::hint::Priority::HIGH),
+                                    ov::intel_cpu::streams_work_stealing(true)),
+                 ov::Exception);
+}
+
 }  // namespace
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/reduce_max.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_min.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                            param
+                     /     |       |     \
+                    /      |       |      \
+            ReduceSum  ReduceMax  ReduceMin  ReduceMean
+                    \      |       |      /
+                     \     |       |     /
+                        Add        Add
+                          \       /
+                             Add
+                              |
+                            Result
+
+The independent branches are small enough to be executed concurrently when the inter-op parallelism is enabled.
+The reductions do not use the shared scratch pad, which would exclude them from the concurrent execution.
+The first inference is sequential, so the model is inferred several times.
+*/
+
+namespace ov {
+namespace test {
+
+class InterOpParallelism : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::inter_op_parallelism.name(), true});
+        configuration.insert({ov::num_streams.name(), 1});
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 8, 4, 4}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto axis = [](int64_t axis) {
+            return ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {axis});
+        };
+        auto reduce_1 = std::make_shared<ov::op::v1::ReduceSum>(param, axis(1), true);
+        auto reduce_2 = std::make_shared<ov::op::v1::ReduceMax>(param, axis(2), true);
+        auto reduce_3 = std::make_shared<ov::op::v1::ReduceMin>(param, axis(3), true);
+        auto reduce_4 = std::make_shared<ov::op::v1::ReduceMean>(param, axis(1), true);
+        reduce_1->set_friendly_name("reduce_1");
+        reduce_2->set_friendly_name("reduce_2");
+        reduce_3->set_friendly_name("reduce_3");
+        reduce_4->set_friendly_name("reduce_4");
+        auto add_1 = utils::make_eltwise(reduce_1, reduce_2, utils::EltwiseTypes::ADD);
+        auto add_2 = utils::make_eltwise(reduce_3, reduce_4, utils::EltwiseTypes::ADD);
+        auto add_3 = utils::make_eltwise(add_1, add_2, utils::EltwiseTypes::ADD);
+        auto result = std::make_shared<ov::op::v0::Result>(add_3);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "Subgraph");
+    }
+
+    // the execution wave of every node of the runtime model executed concurrently with the neighbours
+    std::map<std::string, std::string> execution_waves() const {
+        std::map<std::string, std::string> waves;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rt_info = node->get_rt_info();
+            const auto wave = rt_info.find("execWave");
+            if (wave != rt_info.end()) {
+                waves[node->get_friendly_name()] = wave->second.as<std::string>();
+            }
+        }
+        return waves;
+    }
+};
+
+TEST_F(InterOpParallelism, smoke_CompareWithRefs) {
+    compile_model();
+    for (size_t i = 0; i < 3; i++) {
+        generate_inputs(targetStaticShapes.front());
+        validate();
+    }
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    if (ov::get_number_of_cpu_cores() < 2) {
+        GTEST_SKIP() << "The concurrent execution needs at least 2 threads";
+    }
+    // the reductions of the first branch go one after another in the execution order, so they share the wave
+    const auto waves = execution_waves();
+    ASSERT_EQ(waves.count("reduce_1"), 1u);
+    ASSERT_EQ(waves.count("reduce_2"), 1u);
+    ASSERT_EQ(waves.at("reduce_1"), waves.at("reduce_2"));
+#endif
+}
+
+}  // namespace test
+}  // namespace ov
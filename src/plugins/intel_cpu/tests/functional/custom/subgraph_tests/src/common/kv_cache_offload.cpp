@@ -0,0 +1,217 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/opsets/opset13_decl.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// Subgraph:
+/*                            Parameter
+ *                                |
+ *       Parameter    ReadValue   |    ReadValue  Parameter
+ *           \           /        |       \          /
+ *         Gather       /               Gather      /
+ *             \       /          |         \      /
+ *               Concat           |          Concat
+ *                / \             |            / \
+ *               /   \            |           /   \
+ *              /     \           |          /     \
+ *          Assign     ScaledDotProductAttention  Assign
+ *                                |
+ *                               Add
+ *                                |
+ *                              Result
+ */
+// The KV cache states are paged out to files between the inferences, which must give the same result as the inference
+// with the resident states.
+class KVCacheOffloadTest : public testing::WithParamInterface<ElementType>, virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ElementType>& obj) {
+        std::ostringstream result;
+        result << "KVCachePrc=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::Type(GetParam()).get_type_name();
+        const auto inType = ElementType::f32;
+        const ov::PartialShape shape{-1, heads, -1, headSize};
+
+        ov::ParameterVector inputParams;
+        for (const auto* name : {"q", "k", "v", "pastk_init", "pastv_init"}) {
+            inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(inType, shape));
+            inputParams.back()->set_friendly_name(name);
+        }
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::PartialShape{-1});
+        beam_idx->set_friendly_name("beam_idx");
+        inputParams.push_back(beam_idx);
+
+        auto var_k = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastk"});
+        auto var_v = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastv"});
+        auto pastk = std::make_shared<ov::op::v6::ReadValue>(inputParams[3], var_k);
+        auto pastv = std::make_shared<ov::op::v6::ReadValue>(inputParams[4], var_v);
+        auto axis = op::v0::Constant::create(ElementType::i32, {}, {0});
+        auto gatherK = std::make_shared<ov::op::v8::Gather>(pastk, beam_idx, axis);
+        auto gatherV = std::make_shared<ov::op::v8::Gather>(pastv, beam_idx, axis);
+        auto concatK = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherK, inputParams[1]}, 2);
+        auto concatV = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherV, inputParams[2]}, 2);
+        auto sdp = std::make_shared<ov::opset13::ScaledDotProductAttention>(inputParams[0], concatK, concatV, false);
+        auto add = std::make_shared<ov::op::v1::Add>(sdp, op::v0::Constant::create(inType, {1}, {1.0f}));
+        auto pastk_assign = std::make_shared<op::v6::Assign>(concatK, var_k);
+        auto pastv_assign = std::make_shared<op::v6::Assign>(concatV, var_v);
+
+        function = std::make_shared<ov::Model>(ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                               SinkVector{pastk_assign, pastv_assign},
+                                               inputParams,
+                                               "KVCacheOffload");
+    }
+
+    static ov::Tensor randomTensor(size_t length, int seed) {
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 1000;
+        in_data.seed = seed;
+        return ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, heads, length, headSize}, in_data);
+    }
+
+    static ov::Tensor infer(ov::InferRequest& request, const ov::Tensor& q, const ov::Tensor& k, const ov::Tensor& v) {
+        const auto& params = request.get_compiled_model().inputs();
+        ov::Tensor emptyPast{ov::element::f32, {1, heads, 0, headSize}};
+        ov::Tensor beamIdx{ov::element::i32, {1}};
+        beamIdx.data<int32_t>()[0] = 0;
+        request.set_tensor(params[0], q);
+        request.set_tensor(params[1], k);
+        request.set_tensor(params[2], v);
+        request.set_tensor(params[3], emptyPast);
+        request.set_tensor(params[4], emptyPast);
+        request.set_tensor(params[5], beamIdx);
+        request.infer();
+        const auto& output = request.get_output_tensor(0);
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+
+    static std::map<std::string, uint64_t> getStatistics(const ov::CompiledModel& model) {
+        return model.get_property(ov::intel_cpu::intermediate_memory_statistics);
+    }
+
+    static constexpr size_t heads = 8;
+    static constexpr size_t headSize = 64;
+};
+
+TEST_P(KVCacheOffloadTest, CompareWithResidentStates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    compile_model();
+    const size_t promptLength = 10;
+    const auto promptQ = randomTensor(promptLength, 1);
+    const auto promptK = randomTensor(promptLength, 2);
+    const auto promptV = randomTensor(promptLength, 3);
+    const auto nextQ = randomTensor(1, 4);
+    const auto nextK = randomTensor(1, 5);
+    const auto nextV = randomTensor(1, 6);
+
+    auto reference = compiledModel.create_infer_request();
+    infer(reference, promptQ, promptK, promptV);
+    const auto expectedNext = infer(reference, nextQ, nextK, nextV);
+
+    auto offloaded = compiledModel.create_infer_request();
+    infer(offloaded, promptQ, promptK, promptV);
+    auto states = offloaded.query_state();
+    std::vector<ov::Tensor> expectedStates;
+    std::vector<std::string> paths;
+    for (auto&& state : states) {
+        expectedStates.push_back(state.get_state());
+        paths.push_back(ov::test::utils::generateTestFilePrefix() + "_" + state.get_name() + ".kv");
+        state.offload(paths.back());
+        ASSERT_TRUE(ov::test::utils::fileExists(paths.back()));
+        ASSERT_THROW(state.offload(paths.back()), ov::Exception);
+    }
+    auto statistics = getStatistics(compiledModel);
+    ASSERT_EQ(statistics.at("offloaded_states"), states.size());
+    ASSERT_GT(statistics.at("offloaded_state_bytes"), 0u);
+
+    // the offloaded state is read without paging it in
+    for (size_t i = 0; i < states.size(); i++) {
+        ov::test::utils::compare(expectedStates[i], states[i].get_state(), 1e-3f, 1e-3f);
+    }
+
+    // the first state is paged in explicitly, the rest ones by the inference
+    states.front().restore();
+    ASSERT_FALSE(ov::test::utils::fileExists(paths.front()));
+    ov::test::utils::compare(expectedNext, infer(offloaded, nextQ, nextK, nextV), 1e-3f, 1e-2f);
+    for (const auto& path : paths) {
+        ASSERT_FALSE(ov::test::utils::fileExists(path));
+    }
+    ASSERT_EQ(getStatistics(compiledModel).at("offloaded_states"), 0u);
+
+    // reset discards the offloaded content
+    for (size_t i = 0; i < states.size(); i++) {
+        states[i].offload(paths[i]);
+        states[i].reset();
+        ASSERT_FALSE(ov::test::utils::fileExists(paths[i]));
+    }
+    statistics = getStatistics(compiledModel);
+    ASSERT_EQ(statistics.at("offloaded_states"), 0u);
+    ASSERT_EQ(statistics.at("offloaded_state_bytes"), 0u);
+}
+
+TEST_P(KVCacheOffloadTest, RemoveFilesOfDestroyedRequest) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    // the single stream graph releases the states of the destroyed request once another request is inferred
+    configuration[ov::num_streams.name()] = 1;
+    compile_model();
+    const size_t promptLength = 10;
+    std::vector<std::string> paths;
+    {
+        auto request = compiledModel.create_infer_request();
+        infer(request, randomTensor(promptLength, 1), randomTensor(promptLength, 2), randomTensor(promptLength, 3));
+        for (auto&& state : request.query_state()) {
+            // the existing file is neither overwritten nor removed
+            paths.push_back(ov::test::utils::generateTestFilePrefix() + "_" + state.get_name() + ".kv");
+            ov::test::utils::createFile(paths.back(), "existing");
+            ASSERT_THROW(state.offload(paths.back()), ov::Exception);
+            ASSERT_TRUE(ov::test::utils::fileExists(paths.back()));
+            ov::test::utils::removeFile(paths.back());
+            state.offload(paths.back());
+        }
+        ASSERT_EQ(getStatistics(compiledModel).at("offloaded_states"), paths.size());
+    }
+    auto request = compiledModel.create_infer_request();
+    infer(request, randomTensor(promptLength, 4), randomTensor(promptLength, 5), randomTensor(promptLength, 6));
+    for (const auto& path : paths) {
+        ASSERT_FALSE(ov::test::utils::fileExists(path));
+    }
+    const auto statistics = getStatistics(compiledModel);
+    ASSERT_EQ(statistics.at("offloaded_states"), 0u);
+    ASSERT_EQ(statistics.at("offloaded_state_bytes"), 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_KVCacheOffload,
+                         KVCacheOffloadTest,
+                         ::testing::Values(ElementType::f32, ElementType::u8, ElementType::u4),
+                         KVCacheOffloadTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
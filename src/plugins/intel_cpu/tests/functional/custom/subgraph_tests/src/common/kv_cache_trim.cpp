@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <sstream>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/opsets/opset13_decl.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// Subgraph:
+/*                            Parameter
+ *                                |
+ *       Parameter    ReadValue   |    ReadValue  Parameter
+ *           \           /        |       \          /
+ *         Gather       /               Gather      /
+ *             \       /          |         \      /
+ *               Concat           |          Concat
+ *                / \             |            / \
+ *               /   \            |           /   \
+ *              /     \           |          /     \
+ *          Assign     ScaledDotProductAttention  Assign
+ *                                |
+ *                               Add
+ *                                |
+ *                              Result
+ */
+// The draft tokens are rejected by trimming the KV cache states, which must give the same result as the inference
+// of the accepted tokens only. The keys quantized by channel share the scales within the group of tokens, and the
+// trimmed length falls into the middle of the group.
+using KVCacheTrimTestParams = std::tuple<ElementType,  // KV cache precision
+                                         bool>;        // quantize the keys by channel
+
+class KVCacheTrimTest : public testing::WithParamInterface<KVCacheTrimTestParams>,
+                        virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<KVCacheTrimTestParams>& obj) {
+        const auto& [kvCachePrc, quantKeyByChannel] = obj.param;
+        std::ostringstream result;
+        result << "KVCachePrc=" << kvCachePrc << "_QuantKeyByChannel=" << quantKeyByChannel;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [kvCachePrc, quantKeyByChannel] = GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::Type(kvCachePrc).get_type_name();
+        if (quantKeyByChannel) {
+            configuration[ov::internal::key_cache_quant_mode.name()] = ov::internal::CacheQuantMode::BY_CHANNEL;
+            configuration[ov::key_cache_group_size.name()] = keyGroupSize;
+            // the trimmed group is quantized again with the appended tokens, unlike the one of the reference
+            absThreshold = 5e-2f;
+        }
+        const auto inType = ElementType::f32;
+        const ov::PartialShape shape{-1, heads, -1, headSize};
+
+        ov::ParameterVector inputParams;
+        for (const auto* name : {"q", "k", "v", "pastk_init", "pastv_init"}) {
+            inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(inType, shape));
+            inputParams.back()->set_friendly_name(name);
+        }
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::PartialShape{-1});
+        beam_idx->set_friendly_name("beam_idx");
+        inputParams.push_back(beam_idx);
+
+        auto var_k = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastk"});
+        auto var_v = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastv"});
+        auto pastk = std::make_shared<ov::op::v6::ReadValue>(inputParams[3], var_k);
+        auto pastv = std::make_shared<ov::op::v6::ReadValue>(inputParams[4], var_v);
+        auto axis = op::v0::Constant::create(ElementType::i32, {}, {0});
+        auto gatherK = std::make_shared<ov::op::v8::Gather>(pastk, beam_idx, axis);
+        auto gatherV = std::make_shared<ov::op::v8::Gather>(pastv, beam_idx, axis);
+        auto concatK = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherK, inputParams[1]}, 2);
+        auto concatV = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherV, inputParams[2]}, 2);
+        auto sdp = std::make_shared<ov::opset13::ScaledDotProductAttention>(inputParams[0], concatK, concatV, false);
+        auto add = std::make_shared<ov::op::v1::Add>(sdp, op::v0::Constant::create(inType, {1}, {1.0f}));
+        auto pastk_assign = std::make_shared<op::v6::Assign>(concatK, var_k);
+        auto pastv_assign = std::make_shared<op::v6::Assign>(concatV, var_v);
+
+        function = std::make_shared<ov::Model>(ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                               SinkVector{pastk_assign, pastv_assign},
+                                               inputParams,
+                                               "KVCacheTrim");
+    }
+
+    static ov::Tensor randomTensor(size_t length, int seed) {
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 1000;
+        in_data.seed = seed;
+        return ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, heads, length, headSize}, in_data);
+    }
+
+    // copies the first tokens of the [1, H, L, S] tensor
+    static ov::Tensor firstTokens(const ov::Tensor& tensor, size_t length) {
+        ov::Tensor result{ov::element::f32, {1, heads, length, headSize}};
+        const auto srcLength = tensor.get_shape()[2];
+        for (size_t h = 0; h < heads; h++) {
+            std::memcpy(result.data<float>() + h * length * headSize,
+                        tensor.data<float>() + h * srcLength * headSize,
+                        length * headSize * sizeof(float));
+        }
+        return result;
+    }
+
+    static ov::Tensor infer(ov::InferRequest& request, const ov::Tensor& q, const ov::Tensor& k, const ov::Tensor& v) {
+        const auto& params = request.get_compiled_model().inputs();
+        ov::Tensor emptyPast{ov::element::f32, {1, heads, 0, headSize}};
+        ov::Tensor beamIdx{ov::element::i32, {1}};
+        beamIdx.data<int32_t>()[0] = 0;
+        request.set_tensor(params[0], q);
+        request.set_tensor(params[1], k);
+        request.set_tensor(params[2], v);
+        request.set_tensor(params[3], emptyPast);
+        request.set_tensor(params[4], emptyPast);
+        request.set_tensor(params[5], beamIdx);
+        request.infer();
+        const auto& output = request.get_output_tensor(0);
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+
+    static constexpr size_t heads = 8;
+    static constexpr size_t headSize = 64;
+    static constexpr size_t keyGroupSize = 8;
+    float absThreshold = 1e-3f;
+};
+
+TEST_P(KVCacheTrimTest, CompareWithAcceptedTokens) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    compile_model();
+    const size_t promptLength = 10;
+    const size_t draftLength = 4;
+    const size_t acceptedLength = 2;
+    const auto promptQ = randomTensor(promptLength, 1);
+    const auto promptK = randomTensor(promptLength, 2);
+    const auto promptV = randomTensor(promptLength, 3);
+    const auto draftQ = randomTensor(draftLength, 4);
+    const auto draftK = randomTensor(draftLength, 5);
+    const auto draftV = randomTensor(draftLength, 6);
+    const auto nextQ = randomTensor(1, 7);
+    const auto nextK = randomTensor(1, 8);
+    const auto nextV = randomTensor(1, 9);
+
+    auto speculative = compiledModel.create_infer_request();
+    infer(speculative, promptQ, promptK, promptV);
+    infer(speculative, draftQ, draftK, draftV);
+    for (auto&& state : speculative.query_state()) {
+        ASSERT_EQ(state.get_state().get_shape()[2], promptLength + draftLength);
+        state.trim(promptLength + acceptedLength);
+        ASSERT_EQ(state.get_state().get_shape()[2], promptLength + acceptedLength);
+    }
+    const auto actual = infer(speculative, nextQ, nextK, nextV);
+
+    auto reference = compiledModel.create_infer_request();
+    infer(reference, promptQ, promptK, promptV);
+    infer(reference,
+          firstTokens(draftQ, acceptedLength),
+          firstTokens(draftK, acceptedLength),
+          firstTokens(draftV, acceptedLength));
+    const auto expected = infer(reference, nextQ, nextK, nextV);
+
+    ov::test::utils::compare(expected, actual, absThreshold, 1e-2f);
+
+    for (auto&& state : speculative.query_state()) {
+        ASSERT_THROW(state.trim(promptLength + acceptedLength + 2), ov::Exception);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_KVCacheTrim,
+                         KVCacheTrimTest,
+                         ::testing::Values(KVCacheTrimTestParams{ElementType::f32, false},
+                                           KVCacheTrimTestParams{ElementType::u8, false},
+                                           KVCacheTrimTestParams{ElementType::u4, false},
+                                           KVCacheTrimTestParams{ElementType::u8, true}),
+                         KVCacheTrimTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -9,6 +9,7 @@
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -233,6 +234,60 @@ protected:
     static constexpr size_t N = 2048ul;  // Weights matrix N dimension
 };
 
+class LoraPatternMultiAdapterCPUTest : public LoraPatternBaseCPUTest {
+protected:
+    void init_function() override {
+        ov::PartialShape shape_x = {-1, -1, K};
+        ov::PartialShape shape_w = {N, K};
+
+        auto param_y = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        // Index of the adapter applied to each batch row
+        auto param_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        // "Main" matrix multiplication from the original transformer model
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_y, param_w, false, true);
+
+        // Stacked LoRA parameters of several adapters from states
+        auto states = create_states({{adapters, N, -1}, {adapters, 1, -1}, {adapters, -1, K}},
+                                    {t4_name, t5_name, t6_name});
+        ov::OutputVector gathered;
+        for (const auto& state : states.first) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            gathered.push_back(std::make_shared<ov::op::v8::Gather>(state, param_idx, axis));
+        }
+
+        // Apply the adapters selected per batch row to the current activations
+        auto t5810 = std::make_shared<ov::op::v0::MatMul>(param_y, gathered[2], false, true);
+        auto t5811 = std::make_shared<ov::op::v1::Multiply>(t5810, gathered[1]);
+        auto t5812 = std::make_shared<ov::op::v0::MatMul>(t5811, gathered[0], false, true);
+
+        // Mix LoRA part into normally computed activations after the "main" MatMul
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, t5812);
+
+        auto result_x = std::make_shared<ov::op::v0::Result>(tx);
+        auto result_z = std::make_shared<ov::op::v0::Result>(tz);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector({result_x, result_z}),
+                                               states.second,
+                                               ov::ParameterVector({param_y, param_w, param_idx}));
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        LoraPatternBaseCPUTest::generate_inputs(targetInputStaticShapes);
+        const auto& param_idx = function->get_parameters()[2];
+        auto& tensor = inputs.at(param_idx);
+        auto* data = tensor.data<int32_t>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            data[i] = static_cast<int32_t>((i * 2 + 1) % adapters);
+        }
+    }
+
+    static constexpr size_t K = 563ul;       // Weights matrix K dimension
+    static constexpr size_t N = 2048ul;      // Weights matrix N dimension
+    static constexpr size_t adapters = 3ul;  // Number of the stacked adapters
+};
+
 class LoraPatternConvolutionCPUTest : public LoraPatternBaseCPUTest {
 public:
     void init_function() override {
@@ -289,6 +344,13 @@ TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
 }
 
+TEST_P(LoraPatternMultiAdapterCPUTest, CompareWithRefs) {
+    targetStaticShapes = {{{{4, 20, K}}, {{N, K}}, {{4}}}};
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+}
+
 TEST_P(LoraPatternConvolutionCPUTest, CompareWithRefs) {
     targetStaticShapes = {{{1, num_channels, 10, 15}}};
     run_test();
@@ -305,6 +367,12 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_MatMul, LoraPatternMatmulCPUTes
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_MultiAdapter, LoraPatternMultiAdapterCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(states_precisions),
+                                 ::testing::ValuesIn(states_policies)),
+                         LoraPatternBaseCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPUTest,
                          ::testing::Combine(
                                  ::testing::ValuesIn(states_precisions),
@@ -0,0 +1,221 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "openvino/op/cum_sum.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/less.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+/*This test runs the following subgraph:
+
+                  logits
+                    |
+                 [TopK]
+                  /    \
+              Divide    \
+                 |       \
+              Softmax     \
+                 |         |
+        [CumSum, Less,     |
+            Select]        |
+                 |         |
+            Multinomial    |
+                    \      |
+                  [Gather]
+                       |
+                     Result
+
+The subgraph is fused into the single Multinomial node sampling from the logits with temperature, top-k and top-p.
+Every row draws from its own generator, so the samples of a row must not depend on the other rows, and they must be
+among the candidates kept by top-k and top-p. Zero temperature is greedy sampling, which must give the largest logit
+of every row.
+*/
+
+namespace ov {
+namespace test {
+
+struct SamplingFusionParams {
+    float temperature;
+    int32_t top_k;  // 0 disables top-k
+    float top_p;    // 1 disables top-p
+};
+
+class SamplingFusion : public testing::WithParamInterface<SamplingFusionParams>,
+                       virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SamplingFusionParams>& obj) {
+        std::ostringstream result;
+        result << "temperature=" << obj.param.temperature << "_top_k=" << obj.param.top_k
+               << "_top_p=" << obj.param.top_p;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::test::InputShape input_shape{{-1, vocab_size}, {{rows, vocab_size}}};
+        init_input_shapes({input_shape});
+        function = build_model();
+    }
+
+    std::shared_ptr<ov::Model> build_model() const {
+        const auto& params = GetParam();
+        const auto precision = ov::element::f32;
+        auto logits = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        const bool sorted = params.top_k > 0 || params.top_p < 1.0F;
+        ov::Output<ov::Node> values = logits;
+        std::shared_ptr<ov::op::v11::TopK> topk;
+        if (sorted) {
+            const auto k = params.top_k > 0 ? params.top_k : static_cast<int32_t>(vocab_size);
+            topk = std::make_shared<ov::op::v11::TopK>(logits,
+                                                       ov::op::v0::Constant::create(ov::element::i32, {}, {k}),
+                                                       -1,
+                                                       ov::op::TopKMode::MAX,
+                                                       ov::op::TopKSortType::SORT_VALUES,
+                                                       ov::element::i32);
+            values = topk->output(0);
+        }
+        auto temperature = ov::op::v0::Constant::create(precision, ov::Shape{}, {params.temperature});
+        auto divide = std::make_shared<ov::op::v1::Divide>(values, temperature);
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(divide, -1);
+        ov::Output<ov::Node> probs = softmax;
+        if (params.top_p < 1.0F) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {-1});
+            auto cumsum = std::make_shared<ov::op::v0::CumSum>(softmax, axis, true, false);
+            auto top_p = ov::op::v0::Constant::create(precision, ov::Shape{}, {params.top_p});
+            auto less = std::make_shared<ov::op::v1::Less>(cumsum, top_p);
+            auto zero = ov::op::v0::Constant::create(precision, ov::Shape{}, {0.0F});
+            probs = std::make_shared<ov::op::v1::Select>(less, softmax, zero);
+        }
+        auto num_samples = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {samples});
+        ov::Output<ov::Node> output =
+            std::make_shared<ov::op::v13::Multinomial>(probs, num_samples, ov::element::i32, true, false, 1, 2);
+        if (sorted) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {1});
+            output = std::make_shared<ov::op::v8::Gather>(topk->output(1), output, axis, 1);
+        }
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(output)};
+        return std::make_shared<ov::Model>(results, ov::ParameterVector{logits}, "Sampling");
+    }
+
+    // the logits of a row are distinct, so the order of the equal logits does not matter
+    static ov::Tensor make_logits(unsigned seed = 0) {
+        ov::Tensor logits{ov::element::f32, {rows, vocab_size}};
+        std::vector<int> order(vocab_size);
+        for (size_t row = 0; row < rows; row++) {
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), std::mt19937(static_cast<unsigned>(row) + seed));
+            for (size_t idx = 0; idx < vocab_size; idx++) {
+                logits.data<float>()[row * vocab_size + idx] = static_cast<float>(order[idx]) * 0.01F - 5.0F;
+            }
+        }
+        return logits;
+    }
+
+    // the indices of the logits kept by top-k and top-p in the descending order of the logits
+    std::vector<int32_t> kept_candidates(const float* row) const {
+        const auto& params = GetParam();
+        std::vector<int32_t> candidates(vocab_size);
+        std::iota(candidates.begin(), candidates.end(), 0);
+        std::sort(candidates.begin(), candidates.end(), [&](int32_t lhs, int32_t rhs) {
+            return row[lhs] > row[rhs];
+        });
+        if (params.top_k > 0) {
+            candidates.resize(params.top_k);
+        }
+        std::vector<float> probs(candidates.size());
+        float sum = 0.0F;
+        for (size_t idx = 0; idx < candidates.size(); idx++) {
+            probs[idx] = std::exp((row[candidates[idx]] - row[candidates[0]]) / params.temperature);
+            sum += probs[idx];
+        }
+        // top-p keeps the candidates, whose preceding probability mass is less than top_p, the small tolerance
+        // covers the rounding of the boundary candidate
+        float mass = 0.0F;
+        size_t kept = 0;
+        while (kept < candidates.size() && mass < params.top_p * sum * 1.001F) {
+            mass += probs[kept++];
+        }
+        candidates.resize(kept);
+        return candidates;
+    }
+
+    std::vector<int32_t> infer(ov::CompiledModel& model, const ov::Tensor& logits) const {
+        auto request = model.create_infer_request();
+        request.set_tensor(model.input(), logits);
+        request.infer();
+        const auto output = request.get_output_tensor(0);
+        return {output.data<int32_t>(), output.data<int32_t>() + output.get_size()};
+    }
+
+    static constexpr size_t rows = 4;
+    static constexpr size_t vocab_size = 1000;
+    static constexpr int32_t samples = 16;
+};
+
+TEST_P(SamplingFusion, SampleKeptCandidatesPerRow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    compile_model();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Multinomial", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "TopK", 0);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Softmax", 0);
+
+    const auto logits = make_logits();
+    const auto actual = infer(compiledModel, logits);
+    ASSERT_EQ(actual, infer(compiledModel, logits));
+
+    ASSERT_EQ(actual.size(), rows * samples);
+    if (GetParam().temperature == 0.0F) {
+        const auto* data = logits.data<float>();
+        for (size_t row = 0; row < rows; row++) {
+            const auto* row_data = data + row * vocab_size;
+            const auto expected = static_cast<int32_t>(std::max_element(row_data, row_data + vocab_size) - row_data);
+            for (size_t sample = 0; sample < samples; sample++) {
+                ASSERT_EQ(actual[row * samples + sample], expected);
+            }
+        }
+        return;
+    }
+
+    const auto* data = logits.data<float>();
+    for (size_t row = 0; row < rows; row++) {
+        const auto candidates = kept_candidates(data + row * vocab_size);
+        for (size_t sample = 0; sample < samples; sample++) {
+            ASSERT_NE(std::find(candidates.begin(), candidates.end(), actual[row * samples + sample]),
+                      candidates.end())
+                << "row " << row << " sample " << sample;
+        }
+    }
+
+    // the samples of the first row do not change with the logits of the other rows
+    auto other_logits = make_logits(rows);
+    std::copy_n(data, vocab_size, other_logits.data<float>());
+    const auto other = infer(compiledModel, other_logits);
+    ASSERT_TRUE(std::equal(actual.begin(), actual.begin() + samples, other.begin()));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SamplingFusion,
+                         SamplingFusion,
+                         ::testing::Values(SamplingFusionParams{0.8F, 0, 1.0F},
+                                           SamplingFusionParams{0.8F, 8, 1.0F},
+                                           SamplingFusionParams{1.0F, 0, 0.9F},
+                                           SamplingFusionParams{0.7F, 50, 0.8F},
+                                           SamplingFusionParams{0.0F, 8, 1.0F}),
+                         SamplingFusion::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
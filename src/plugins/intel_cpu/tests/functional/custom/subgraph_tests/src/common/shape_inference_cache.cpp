@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/softmax.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                  param    const
+                 /    \      |
+                /   ShapeOf  |
+               /        \    |
+           Softmax      Broadcast
+                 \        /
+                     Add
+                      |
+                    Result
+
+The input shapes repeat, so the output shapes of the second pass over them are taken from the shape inference cache.
+The Broadcast node has the data dependent shape inference, but its target shape is determined by the input shape.
+*/
+
+namespace ov {
+namespace test {
+
+class ShapeInferenceCache : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::shape_inference_cache_capacity.name(), 4});
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{-1, -1, 8}, {{1, 3, 8}, {2, 5, 8}, {1, 3, 8}, {2, 5, 8}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(param, 2);
+        auto shape_of = std::make_shared<ov::op::v3::ShapeOf>(param);
+        auto one = std::make_shared<ov::op::v0::Constant>(precision, ov::Shape{1}, std::vector<float>{1.0f});
+        auto broadcast = std::make_shared<ov::op::v3::Broadcast>(one, shape_of);
+        auto add = utils::make_eltwise(softmax, broadcast, utils::EltwiseTypes::ADD);
+        auto result = std::make_shared<ov::op::v0::Result>(add);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "Subgraph");
+    }
+};
+
+TEST_F(ShapeInferenceCache, smoke_CompareWithRefs) {
+    run();
+
+    const auto stats = compiledModel.get_property(ov::intel_cpu::cpu_runtime_cache_statistics);
+    // two distinct input shapes, each one repeated once
+    EXPECT_EQ(stats.at("ShapeInferenceCache.misses"), 2);
+    EXPECT_EQ(stats.at("ShapeInferenceCache.hits"), 2);
+    EXPECT_EQ(stats.at("ShapeInferenceCache.entries"), 2);
+}
+
+}  // namespace test
+}  // namespace ov
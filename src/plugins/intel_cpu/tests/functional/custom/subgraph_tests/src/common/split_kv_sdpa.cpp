@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <limits>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/opsets/opset13_decl.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+namespace ov {
+namespace test {
+
+// Subgraph:
+/*                            Parameter
+ *   Parameter                    |                   Parameter
+ *       |                        |                       |
+ *   ReadValue   Parameter        |        Parameter  ReadValue
+ *       |           |            |            |          |
+ *     Gather        |            |            |        Gather
+ *         \        /             |             \        /
+ *          Concat                |               Concat
+ *           /   \                |               /   \
+ *       Assign   ScaledDotProductAttention------/    Assign
+ *                                |
+ *                            Parameter (attention mask)
+ */
+// The single head of the attention can't occupy the threads, so the decoding of the long context splits it into the
+// chunks. The attention mask hides the beginning of the context, so the first chunks are fully masked and must be
+// skipped by the merge of the chunks. The result must be the same as the one of the single thread, which doesn't split
+// the context.
+class SplitKVSDPATest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::f32;
+        configuration[ov::num_streams.name()] = 1;
+        const auto inType = ElementType::f32;
+        const ov::PartialShape shape{1, 1, -1, headSize};
+
+        ov::ParameterVector inputParams;
+        for (const auto* name : {"q", "k", "v", "pastk_init", "pastv_init"}) {
+            inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(inType, shape));
+            inputParams.back()->set_friendly_name(name);
+        }
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::PartialShape{-1});
+        beam_idx->set_friendly_name("beam_idx");
+        inputParams.push_back(beam_idx);
+        auto attn_mask = std::make_shared<ov::op::v0::Parameter>(inType, ov::PartialShape{1, 1, -1, -1});
+        attn_mask->set_friendly_name("attn_mask");
+        inputParams.push_back(attn_mask);
+
+        auto var_k = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastk"});
+        auto var_v = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastv"});
+        auto pastk = std::make_shared<ov::op::v6::ReadValue>(inputParams[3], var_k);
+        auto pastv = std::make_shared<ov::op::v6::ReadValue>(inputParams[4], var_v);
+        auto axis = op::v0::Constant::create(ElementType::i32, {}, {0});
+        auto gatherK = std::make_shared<ov::op::v8::Gather>(pastk, beam_idx, axis);
+        auto gatherV = std::make_shared<ov::op::v8::Gather>(pastv, beam_idx, axis);
+        auto concatK = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherK, inputParams[1]}, 2);
+        auto concatV = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherV, inputParams[2]}, 2);
+        auto sdp = std::make_shared<ov::opset13::ScaledDotProductAttention>(inputParams[0],
+                                                                            concatK,
+                                                                            concatV,
+                                                                            attn_mask,
+                                                                            false);
+        auto pastk_assign = std::make_shared<op::v6::Assign>(concatK, var_k);
+        auto pastv_assign = std::make_shared<op::v6::Assign>(concatV, var_v);
+
+        function = std::make_shared<ov::Model>(ResultVector{std::make_shared<ov::op::v0::Result>(sdp)},
+                                               SinkVector{pastk_assign, pastv_assign},
+                                               inputParams,
+                                               "SplitKVSDPA");
+    }
+
+    static ov::Tensor randomTensor(size_t length, int seed) {
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 1000;
+        in_data.seed = seed;
+        return ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 1, length, headSize}, in_data);
+    }
+
+    // the first maskedLen tokens of the context are hidden from the queries
+    static ov::Tensor infer(ov::InferRequest& request, size_t length, size_t pastLen, size_t maskedLen, int seed) {
+        const auto& params = request.get_compiled_model().inputs();
+        ov::Tensor beamIdx{ov::element::i32, {1}};
+        beamIdx.data<int32_t>()[0] = 0;
+        const size_t kvLen = pastLen + length;
+        ov::Tensor mask{ov::element::f32, {1, 1, length, kvLen}};
+        for (size_t i = 0; i < length; i++) {
+            for (size_t j = 0; j < kvLen; j++) {
+                mask.data<float>()[i * kvLen + j] = j < maskedLen ? -std::numeric_limits<float>::infinity() : 0.0f;
+            }
+        }
+        request.set_tensor(params[0], randomTensor(length, seed));
+        request.set_tensor(params[1], randomTensor(length, seed + 1));
+        request.set_tensor(params[2], randomTensor(length, seed + 2));
+        request.set_tensor(params[3], randomTensor(0, seed + 3));
+        request.set_tensor(params[4], randomTensor(0, seed + 4));
+        request.set_tensor(params[5], beamIdx);
+        request.set_tensor(params[6], mask);
+        request.infer();
+        const auto& output = request.get_output_tensor(0);
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+
+    static constexpr size_t headSize = 64;
+};
+
+TEST_F(SplitKVSDPATest, MaskedChunks) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    if (ov::get_number_of_cpu_cores() < 2) {
+        GTEST_SKIP() << "The context is split only between several threads";
+    }
+    auto model = core->compile_model(function, targetDevice, configuration);
+    auto referenceConfiguration = configuration;
+    referenceConfiguration[ov::inference_num_threads.name()] = 1;
+    auto referenceModel = core->compile_model(function, targetDevice, referenceConfiguration);
+
+    auto actual = model.create_infer_request();
+    auto reference = referenceModel.create_infer_request();
+    const size_t promptLen = 1024;
+    // the prompt isn't masked, then the decoding steps hide the first 600 tokens, i.e. more than a half of the context
+    ov::test::utils::compare(infer(reference, promptLen, 0, 0, 0), infer(actual, promptLen, 0, 0, 0), 1e-3f, 1e-2f);
+    for (size_t step = 0; step < 3; step++) {
+        const auto seed = static_cast<int>(step + 1) * 10;
+        const auto expected = infer(reference, 1, promptLen + step, 600, seed);
+        const auto result = infer(actual, 1, promptLen + step, 600, seed);
+        for (size_t i = 0; i < result.get_size(); i++) {
+            ASSERT_FALSE(std::isnan(result.data<float>()[i]));
+        }
+        ov::test::utils::compare(expected, result, 1e-3f, 1e-2f);
+    }
+}
+
+}  // namespace test
+}  // namespace ov
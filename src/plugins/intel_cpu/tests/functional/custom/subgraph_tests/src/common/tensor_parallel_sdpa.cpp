@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/opsets/opset13_decl.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// Subgraph:
+/*                            Parameter
+ *   Parameter                    |                   Parameter
+ *       |                        |                       |
+ *    Multiply                    |                    Multiply
+ *       |                        |                       |
+ *   ReadValue   Parameter        |        Parameter  ReadValue
+ *       |           |            |            |          |
+ *     Gather        |            |            |        Gather
+ *         \        /             |             \        /
+ *          Concat                |               Concat
+ *           /   \                |               /   \
+ *       Assign   ScaledDotProductAttention------/    Assign
+ *                                |
+ *                               Add
+ *                                |
+ *                              Result
+ */
+// The heads of the attention and its KV cache states are split between the tensor parallel sub-streams, so the states
+// initialized by the initializer subgraph and the states reset between the inferences must give the same result as
+// the model compiled without tensor parallel.
+class TensorParallelSDPATest : public testing::WithParamInterface<ElementType>,
+                               virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ElementType>& obj) {
+        std::ostringstream result;
+        result << "KVCachePrc=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::Type(GetParam()).get_type_name();
+        const auto inType = ElementType::f32;
+        const ov::PartialShape shape{-1, heads, -1, headSize};
+
+        ov::ParameterVector inputParams;
+        for (const auto* name : {"q", "k", "v", "pastk_init", "pastv_init"}) {
+            inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(inType, shape));
+            inputParams.back()->set_friendly_name(name);
+        }
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::PartialShape{-1});
+        beam_idx->set_friendly_name("beam_idx");
+        inputParams.push_back(beam_idx);
+
+        auto var_k = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastk"});
+        auto var_v = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, inType, "pastv"});
+        auto scale = op::v0::Constant::create(inType, {1}, {0.5f});
+        auto initK = std::make_shared<ov::op::v1::Multiply>(inputParams[3], scale);
+        auto initV = std::make_shared<ov::op::v1::Multiply>(inputParams[4], scale);
+        auto pastk = std::make_shared<ov::op::v6::ReadValue>(initK, var_k);
+        auto pastv = std::make_shared<ov::op::v6::ReadValue>(initV, var_v);
+        auto axis = op::v0::Constant::create(ElementType::i32, {}, {0});
+        auto gatherK = std::make_shared<ov::op::v8::Gather>(pastk, beam_idx, axis);
+        auto gatherV = std::make_shared<ov::op::v8::Gather>(pastv, beam_idx, axis);
+        auto concatK = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherK, inputParams[1]}, 2);
+        auto concatV = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherV, inputParams[2]}, 2);
+        auto sdp = std::make_shared<ov::opset13::ScaledDotProductAttention>(inputParams[0], concatK, concatV, false);
+        auto add = std::make_shared<ov::op::v1::Add>(sdp, op::v0::Constant::create(inType, {1}, {1.0f}));
+        auto pastk_assign = std::make_shared<op::v6::Assign>(concatK, var_k);
+        auto pastv_assign = std::make_shared<op::v6::Assign>(concatV, var_v);
+
+        function = std::make_shared<ov::Model>(ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                               SinkVector{pastk_assign, pastv_assign},
+                                               inputParams,
+                                               "TensorParallelSDPA");
+    }
+
+    static ov::Tensor randomTensor(size_t length, int seed) {
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 1000;
+        in_data.seed = seed;
+        return ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, heads, length, headSize}, in_data);
+    }
+
+    static ov::Tensor infer(ov::InferRequest& request, size_t length, size_t initLength, int seed) {
+        const auto& params = request.get_compiled_model().inputs();
+        ov::Tensor beamIdx{ov::element::i32, {1}};
+        beamIdx.data<int32_t>()[0] = 0;
+        request.set_tensor(params[0], randomTensor(length, seed));
+        request.set_tensor(params[1], randomTensor(length, seed + 1));
+        request.set_tensor(params[2], randomTensor(length, seed + 2));
+        request.set_tensor(params[3], randomTensor(initLength, seed + 3));
+        request.set_tensor(params[4], randomTensor(initLength, seed + 4));
+        request.set_tensor(params[5], beamIdx);
+        request.infer();
+        const auto& output = request.get_output_tensor(0);
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+
+    static constexpr size_t heads = 8;
+    static constexpr size_t headSize = 64;
+};
+
+TEST_P(TensorParallelSDPATest, CompareWithoutTensorParallel) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto referenceModel = core->compile_model(function, targetDevice, configuration);
+    auto tpConfiguration = configuration;
+    tpConfiguration[ov::hint::model_distribution_policy.name()] = "TENSOR_PARALLEL";
+    tpConfiguration[ov::intel_cpu::enable_tensor_parallel.name()] = true;
+    tpConfiguration[ov::num_streams.name()] = 1;
+    tpConfiguration[ov::inference_num_threads.name()] = 1;
+    auto tpModel = core->compile_model(function, targetDevice, tpConfiguration);
+
+    auto reference = referenceModel.create_infer_request();
+    auto actual = tpModel.create_infer_request();
+    // {query length, initializer length}: the first inference and the inference after the reset run the initializer
+    const std::vector<std::pair<size_t, size_t>> steps{{10, 3}, {1, 3}, {1, 3}};
+    for (size_t reset = 0; reset < 2; reset++) {
+        int seed = static_cast<int>(reset) * 100;
+        for (const auto& step : steps) {
+            const auto expected = infer(reference, step.first, step.second, seed);
+            const auto result = infer(actual, step.first, step.second, seed);
+            ov::test::utils::compare(expected, result, 1e-3f, 1e-2f);
+            seed += 10;
+        }
+        // the heads of the states split between the sub-streams are gathered into the full states
+        auto referenceStates = reference.query_state();
+        auto actualStates = actual.query_state();
+        ASSERT_EQ(actualStates.size(), referenceStates.size());
+        for (size_t i = 0; i < actualStates.size(); i++) {
+            ASSERT_EQ(actualStates[i].get_name(), referenceStates[i].get_name());
+            ov::test::utils::compare(referenceStates[i].get_state(), actualStates[i].get_state(), 1e-2f, 1e-2f);
+        }
+        // and the full states are scattered back, while a part of the heads is rejected
+        for (size_t i = 0; i < actualStates.size(); i++) {
+            const auto state = referenceStates[i].get_state();
+            auto partShape = state.get_shape();
+            partShape[1] /= 2;
+            ASSERT_THROW(actualStates[i].set_state(ov::Tensor{state.get_element_type(), partShape}), ov::Exception);
+            // both models quantize the same state again
+            referenceStates[i].set_state(state);
+            actualStates[i].set_state(state);
+        }
+        const auto expected = infer(reference, 1, 3, seed);
+        const auto result = infer(actual, 1, 3, seed);
+        ov::test::utils::compare(expected, result, 1e-3f, 1e-2f);
+        reference.reset_state();
+        actual.reset_state();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorParallelSDPA,
+                         TensorParallelSDPATest,
+                         ::testing::Values(ElementType::f32, ElementType::u8),
+                         TensorParallelSDPATest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
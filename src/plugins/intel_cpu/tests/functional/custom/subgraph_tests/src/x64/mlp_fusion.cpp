@@ -12,6 +12,8 @@
 #include "openvino/op/gelu.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/op/swish.hpp"
 
 namespace ov {
@@ -23,6 +25,9 @@ struct LLMMLPFusionParams {
     size_t up_size;
     std::string act_type;
     bool use_dynamic_quant;
+    // i8: symmetrically quantized per OC, u8: compressed with per OC zero points,
+    // u4: compressed group-wise, which is not fused as the per OC i8 kernels would lose the group scales
+    ov::element::Type weights_type = ov::element::i8;
 };
 
 class LLMMLPFusionTest : public testing::WithParamInterface<LLMMLPFusionParams>, public ov::test::SubgraphBaseTest {
@@ -39,6 +44,7 @@ public:
         result << "up_size=" << obj.param.up_size << "_";
         result << "act_type=" << obj.param.act_type << "_";
         result << "use_dynamic_quant=" << obj.param.use_dynamic_quant << "_";
+        result << "weights_type=" << obj.param.weights_type << "_";
         result << obj.index;
         return result.str();
     }
@@ -56,6 +62,52 @@ protected:
         auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
 
         auto create_const = [&](size_t OC, size_t IC, int resolution) -> std::shared_ptr<ov::Node> {
+            if (param.use_dynamic_quant && param.weights_type == ov::element::u8) {
+                // the weights shifted by the zero points stay in [-127, 127], so they are converted to i8 exactly
+                ov::test::utils::InputGenerateData in_data;
+                in_data.start_from = 8;
+                in_data.range = 239;
+                auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::u8, ov::Shape{OC, IC}, in_data);
+                auto weight_const_u8 = std::make_shared<ov::op::v0::Constant>(tensor);
+                auto weight_const_f16 = std::make_shared<ov::op::v0::Convert>(weight_const_u8, ov::element::f16);
+                in_data.start_from = 120;
+                in_data.range = 15;
+                auto tensor_zp = ov::test::utils::create_and_fill_tensor(ov::element::u8, ov::Shape{OC, 1}, in_data);
+                auto zp = std::make_shared<ov::op::v0::Constant>(tensor_zp);
+                auto zp_f16 = std::make_shared<ov::op::v0::Convert>(zp, ov::element::f16);
+                auto weight_sub = std::make_shared<ov::op::v1::Subtract>(weight_const_f16, zp_f16);
+
+                // range after dequantize, about [-1, +1]
+                auto scales = ov::op::v0::Constant::create(ov::element::f16, ov::Shape{OC, 1}, {1.0f / 128});
+                auto weight_deq = std::make_shared<ov::op::v1::Multiply>(weight_sub, scales);
+                return std::make_shared<ov::op::v0::Convert>(weight_deq, ov::element::f32);
+            }
+            if (param.use_dynamic_quant && param.weights_type == ov::element::u4) {
+                const size_t group_size = 128;
+                const ov::Shape groups_shape{OC, IC / group_size, 1};
+                ov::test::utils::InputGenerateData in_data;
+                in_data.start_from = 0;
+                in_data.range = 15;
+                auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::u4,
+                                                                      ov::Shape{OC, IC / group_size, group_size},
+                                                                      in_data);
+                auto weight_const_u4 = std::make_shared<ov::op::v0::Constant>(tensor);
+                auto weight_const_f16 = std::make_shared<ov::op::v0::Convert>(weight_const_u4, ov::element::f16);
+                auto zp = ov::op::v0::Constant::create(ov::element::u4, groups_shape, {8});
+                auto zp_f16 = std::make_shared<ov::op::v0::Convert>(zp, ov::element::f16);
+                auto weight_sub = std::make_shared<ov::op::v1::Subtract>(weight_const_f16, zp_f16);
+
+                // group scales within [1/16, 1 + 1/16]
+                in_data.start_from = 0.0625;
+                in_data.range = 1;
+                in_data.resolution = 256;
+                auto tensor_scales = ov::test::utils::create_and_fill_tensor(ov::element::f16, groups_shape, in_data);
+                auto scales = std::make_shared<ov::op::v0::Constant>(tensor_scales);
+                auto weight_deq = std::make_shared<ov::op::v1::Multiply>(weight_sub, scales);
+                auto weight_shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {OC, IC});
+                auto weight_reshape = std::make_shared<ov::op::v1::Reshape>(weight_deq, weight_shape, false);
+                return std::make_shared<ov::op::v0::Convert>(weight_reshape, ov::element::f32);
+            }
             if (param.use_dynamic_quant) {
                 ov::test::utils::InputGenerateData in_data;
                 // range [-128, +127]
@@ -116,13 +168,16 @@ protected:
             if (layer_type == "LLMMLP")
                 fused_node_found++;
         }
-        ASSERT_EQ(fused_node_found, 1);
+        const auto& param = this->GetParam();
+        const bool fused = !param.use_dynamic_quant || param.weights_type != ov::element::u4;
+        ASSERT_EQ(fused_node_found, fused ? 1 : 0);
     }
 };
 
 TEST_P(LLMMLPFusionTest, CompareWithRefs) {
     if (!ov::with_cpu_x86_avx512_core_amx_bf16())
         GTEST_SKIP();
+    // the outputs are compared with the reference outputs of the unfused graph
     run();
     check_results();
 }
@@ -136,6 +191,8 @@ const std::vector<LLMMLPFusionParams> mlp_params = {
     {ishape, 4096 / 4, 11008 / 4, "Gelu", true},
     {ishape, 4096 / 4, 11008 / 4, "Swish", false},
     {ishape, 4096 / 4, 11008 / 4, "Swish", true},
+    {ishape, 4096 / 4, 11008 / 4, "Swish", true, ov::element::u8},
+    {ishape, 4096 / 4, 11008 / 4, "Swish", true, ov::element::u4},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_LLMMLPFusion,
@@ -0,0 +1,197 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <random>
+
+#include "common_test_utils/include/common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ov::op;
+
+namespace ov {
+namespace test {
+
+// The prompt of the PagedAttention is split into the blocks of xattention_block_size tokens, and the queries and the
+// keys of a block are aligned with the topic of the block, orthogonal to the other topics. So the attention of a query
+// block is concentrated on the blocks of its topic, and the block-sparse prefill skips the blocks of the other topics
+// with a negligible attention mass. The threshold of 1 keeps every block and must give the dense result bit by bit.
+class PagedAttnXAttentionTest : public testing::WithParamInterface<ElementType>,
+                                virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ElementType>& obj) {
+        std::ostringstream result;
+        result << "KVCachePrc=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<v0::Parameter> make_param(const PartialShape& pshape,
+                                                     element::Type element_type,
+                                                     const std::string& name) {
+        auto param = std::make_shared<v0::Parameter>(element_type, pshape);
+        param->set_friendly_name(name);
+        param->get_output_tensor(0).set_names({name});
+        return param;
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::Type(GetParam()).get_type_name();
+
+        const auto hidden = static_cast<int64_t>(heads * headSize);
+        auto q = make_param(PartialShape{-1, hidden}, ov::element::f32, "q");
+        auto k = make_param(PartialShape{-1, hidden}, ov::element::f32, "k");
+        auto v = make_param(PartialShape{-1, hidden}, ov::element::f32, "v");
+        auto key_cache = make_param(PartialShape{-1, 32, -1}, ov::element::dynamic, "key_cache.0");
+        auto value_cache = make_param(PartialShape{-1, 32, -1}, ov::element::dynamic, "value_cache.0");
+        auto past_lens = make_param(PartialShape{-1}, ov::element::i32, "past_lens");
+        auto subsequence_begins = make_param(PartialShape{-1}, ov::element::i32, "subsequence_begins");
+        auto block_indices = make_param(PartialShape{-1}, ov::element::i32, "block_indices");
+        auto block_indices_begins = make_param(PartialShape{-1}, ov::element::i32, "block_indices_begins");
+        auto xattention_threshold = make_param(PartialShape{-1}, ov::element::f32, "xattention_threshold");
+        auto scale = v0::Constant::create(ov::element::f32, Shape{}, {1.0f / std::sqrt(static_cast<float>(headSize))});
+        auto sliding_window = v0::Constant::create(ov::element::i32, Shape{}, {0});
+        auto alibi_slopes = v0::Constant::create(ov::element::f32, Shape{0}, std::vector<float>{});
+        auto max_context_len = v0::Constant::create(ov::element::i32, Shape{}, {promptLen});
+        auto score_aggregation_window = v0::Constant::create(ov::element::i32, Shape{}, {0});
+        auto rotated_block_indices = v0::Constant::create(ov::element::i32, Shape{0}, std::vector<int32_t>{});
+        auto rotation_deltas = v0::Constant::create(ov::element::i32, Shape{0}, std::vector<int32_t>{});
+        auto rotation_trig_lut = v0::Constant::create(ov::element::f32, Shape{0}, std::vector<float>{});
+        auto xattention_block_size = v0::Constant::create(ov::element::i32, Shape{}, {sparseBlockSize});
+        auto xattention_stride = v0::Constant::create(ov::element::i32, Shape{}, {8});
+        auto paged_attn = std::make_shared<op::PagedAttentionExtension>(OutputVector{q,
+                                                                                     k,
+                                                                                     v,
+                                                                                     key_cache,
+                                                                                     value_cache,
+                                                                                     past_lens,
+                                                                                     subsequence_begins,
+                                                                                     block_indices,
+                                                                                     block_indices_begins,
+                                                                                     scale,
+                                                                                     sliding_window,
+                                                                                     alibi_slopes,
+                                                                                     max_context_len,
+                                                                                     score_aggregation_window,
+                                                                                     rotated_block_indices,
+                                                                                     rotation_deltas,
+                                                                                     rotation_trig_lut,
+                                                                                     xattention_threshold,
+                                                                                     xattention_block_size,
+                                                                                     xattention_stride});
+        paged_attn->get_rt_info()["num_k_heads"] = heads;
+        paged_attn->get_rt_info()["k_head_size"] = headSize;
+        paged_attn->get_rt_info()["num_v_heads"] = heads;
+        paged_attn->get_rt_info()["v_head_size"] = headSize;
+        function = std::make_shared<ov::Model>(OutputVector{paged_attn},
+                                               ParameterVector{q,
+                                                               k,
+                                                               v,
+                                                               key_cache,
+                                                               value_cache,
+                                                               past_lens,
+                                                               subsequence_begins,
+                                                               block_indices,
+                                                               block_indices_begins,
+                                                               xattention_threshold},
+                                               "PagedAttnXAttention");
+    }
+
+    // the token of the topic t is 2 in the dimensions [16 * t, 16 * t + 16) of every head plus a small noise
+    static ov::Tensor topic_tensor(int seed) {
+        ov::Tensor tensor{ov::element::f32, {promptLen, heads * headSize}};
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> noise(-0.1f, 0.1f);
+        auto* data = tensor.data<float>();
+        for (size_t token = 0; token < promptLen; token++) {
+            const size_t topic = (token / sparseBlockSize) % topics;
+            for (size_t i = 0; i < heads * headSize; i++) {
+                const bool in_topic = (i % headSize) / (headSize / topics) == topic;
+                data[token * heads * headSize + i] = (in_topic ? 2.0f : 0.0f) + noise(gen);
+            }
+        }
+        return tensor;
+    }
+
+    ov::Tensor infer(float threshold) {
+        auto request = compiledModel.create_infer_request();
+        const size_t cacheBlocks = promptLen / 32;
+        for (const auto& input : compiledModel.inputs()) {
+            const auto& name = input.get_any_name();
+            if (name == "key_cache.0" || name == "value_cache.0") {
+                auto pshape = input.get_partial_shape();
+                pshape[0] = cacheBlocks;
+                request.set_tensor(input, ov::Tensor(input.get_element_type(), pshape.get_shape()));
+            }
+        }
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 1000;
+        request.set_tensor("q", topic_tensor(1));
+        request.set_tensor("k", topic_tensor(2));
+        request.set_tensor("v",
+                           ov::test::utils::create_and_fill_tensor(ov::element::f32,
+                                                                   {promptLen, heads * headSize},
+                                                                   in_data));
+        ov::Tensor past_lens{ov::element::i32, {1}};
+        ov::Tensor subsequence_begins{ov::element::i32, {2}};
+        ov::Tensor block_indices{ov::element::i32, {cacheBlocks}};
+        ov::Tensor block_indices_begins{ov::element::i32, {2}};
+        ov::Tensor xattention_threshold{ov::element::f32, {1}};
+        past_lens.data<int32_t>()[0] = 0;
+        subsequence_begins.data<int32_t>()[0] = 0;
+        subsequence_begins.data<int32_t>()[1] = static_cast<int32_t>(promptLen);
+        for (size_t i = 0; i < cacheBlocks; i++) {
+            block_indices.data<int32_t>()[i] = static_cast<int32_t>(i);
+        }
+        block_indices_begins.data<int32_t>()[0] = 0;
+        block_indices_begins.data<int32_t>()[1] = static_cast<int32_t>(cacheBlocks);
+        xattention_threshold.data<float>()[0] = threshold;
+        request.set_tensor("past_lens", past_lens);
+        request.set_tensor("subsequence_begins", subsequence_begins);
+        request.set_tensor("block_indices", block_indices);
+        request.set_tensor("block_indices_begins", block_indices_begins);
+        request.set_tensor("xattention_threshold", xattention_threshold);
+        request.infer();
+        const auto& output = request.get_output_tensor(0);
+        ov::Tensor copy{output.get_element_type(), output.get_shape()};
+        output.copy_to(copy);
+        return copy;
+    }
+
+    static constexpr size_t heads = 8;
+    static constexpr size_t headSize = 64;
+    static constexpr size_t topics = 4;
+    static constexpr size_t sparseBlockSize = 64;
+    static constexpr size_t promptLen = 8 * sparseBlockSize;
+};
+
+TEST_P(PagedAttnXAttentionTest, CompareWithDense) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    compile_model();
+    // the threshold <= 0 runs the dense prefill
+    const auto dense = infer(0.0f);
+    const auto allKept = infer(1.0f);
+    ASSERT_EQ(std::memcmp(dense.data(), allKept.data(), dense.get_byte_size()), 0);
+
+    const auto sparse = infer(0.9f);
+    // the blocks of the other topics are skipped, which changes the result a bit
+    ASSERT_NE(std::memcmp(dense.data(), sparse.data(), dense.get_byte_size()), 0);
+    ov::test::utils::compare(dense, sparse, 1e-2f, 1e-2f);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnXAttention,
+                         PagedAttnXAttentionTest,
+                         ::testing::Values(ElementType::f16, ElementType::u8),
+                         PagedAttnXAttentionTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
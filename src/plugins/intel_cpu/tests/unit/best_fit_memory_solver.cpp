@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/best_fit_memory_solver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "openvino/runtime/memory_solver.hpp"
+
+using namespace ov::intel_cpu;
+using Box = ov::MemorySolver::Box;
+
+namespace {
+void checkSolution(const std::vector<Box>& boxes, const BestFitMemorySolver& solver, int64_t arenaSize) {
+    auto normalized = boxes;
+    ov::MemorySolver::normalize_boxes(normalized);
+    for (const auto& l : normalized) {
+        const auto lOffset = solver.getOffset(l.id);
+        ASSERT_GE(lOffset, 0);
+        ASSERT_LE(lOffset + l.size, arenaSize);
+        for (const auto& r : normalized) {
+            if (l.id == r.id || l.start > r.finish || r.start > l.finish) {
+                continue;
+            }
+            const auto rOffset = solver.getOffset(r.id);
+            ASSERT_TRUE(lOffset + l.size <= rOffset || rOffset + r.size <= lOffset)
+                << "boxes " << l.id << " and " << r.id << " overlap";
+        }
+    }
+}
+}  // namespace
+
+TEST(BestFitMemorySolverTest, Simple) {
+    std::vector<Box> boxes{{2, 4, 2, 0}, {4, 5, 5, 1}, {5, 6, 6, 2}, {0, 1, 6, 3}, {2, 3, 5, 4}};
+
+    BestFitMemorySolver solver(boxes);
+    const auto arenaSize = solver.solve();
+    checkSolution(boxes, solver, arenaSize);
+    EXPECT_EQ(solver.getLowerBound(), 11);
+    EXPECT_EQ(arenaSize, 11);
+
+    // the first-fit placement of the same boxes is worse
+    ov::MemorySolver firstFitSolver(boxes);
+    EXPECT_GT(firstFitSolver.solve(), arenaSize);
+}
+
+TEST(BestFitMemorySolverTest, InfiniteLifetime) {
+    std::vector<Box> boxes{{0, -1, 4, 0}, {1, 2, 4, 1}, {3, 4, 4, 2}, {5, 5, 8, 3}};
+
+    BestFitMemorySolver solver(boxes);
+    const auto arenaSize = solver.solve();
+    checkSolution(boxes, solver, arenaSize);
+    EXPECT_EQ(solver.getLowerBound(), 12);
+    EXPECT_EQ(arenaSize, 12);
+}
+
+TEST(BestFitMemorySolverTest, Random) {
+    std::mt19937 gen(42);
+    for (size_t test = 0; test < 20; ++test) {
+        std::vector<Box> boxes;
+        const int64_t boxesNum = 10 + static_cast<int64_t>(gen() % 100);
+        for (int64_t id = 0; id < boxesNum; ++id) {
+            const int start = static_cast<int>(gen() % 50);
+            const int finish = gen() % 10 == 0 ? -1 : start + static_cast<int>(gen() % 10);
+            boxes.push_back({start, finish, static_cast<int64_t>(1 + gen() % 1000), id});
+        }
+
+        BestFitMemorySolver solver(boxes);
+        const auto arenaSize = solver.solve();
+        checkSolution(boxes, solver, arenaSize);
+        ASSERT_LE(solver.getLowerBound(), arenaSize);
+    }
+}
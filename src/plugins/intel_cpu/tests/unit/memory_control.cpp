@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_control.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryRegion dynamicRegion(int start, int finish, int64_t id, int64_t maxSize) {
+    return {start,
+            finish,
+            -1,
+            id,
+            MemoryRegion::RegionType::VARIABLE,
+            MemoryRegion::AllocType::POD,
+            maxSize};
+}
+}  // namespace
+
+TEST(MemoryControlTest, StaticArenaStatistics) {
+    NetworkMemoryControl networkControl;
+    auto control = networkControl.createMemoryControlUnit("main");
+    control->insert({{0, 1, 64, 0, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD, 64},
+                     {1, 2, 64, 1, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD, 64},
+                     {2, 3, 64, 2, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD, 64}},
+                    {});
+    auto solution = control->solve();
+    ASSERT_EQ(solution.size(), 3);
+
+    const auto stats = control->getArenaStatistics();
+    EXPECT_EQ(stats.lower_bound, 128);
+    EXPECT_EQ(stats.arena_size, 128);
+    EXPECT_EQ(stats.reallocations, 0);
+}
+
+TEST(MemoryControlTest, DynamicGrowth) {
+    NetworkMemoryControl networkControl(DynamicMemoryPolicy{2.0F, false, false});
+    auto control = networkControl.createMemoryControlUnit("main");
+    control->insert({dynamicRegion(0, 1, 0, -1)}, {});
+    auto solution = control->solve();
+    control->allocateMemory();
+
+    auto block = solution.at(0);
+    EXPECT_TRUE(block->resize(1000));
+    // the first allocation of the empty block is not counted
+    EXPECT_EQ(control->getArenaStatistics().reallocations, 0);
+    EXPECT_TRUE(block->resize(1001));
+    // the block has grown geometrically, so there is no need to reallocate
+    EXPECT_FALSE(block->resize(2000));
+    EXPECT_EQ(control->getArenaStatistics().reallocations, 1);
+}
+
+TEST(MemoryControlTest, DynamicReserve) {
+    NetworkMemoryControl networkControl(DynamicMemoryPolicy{1.0F, true, false});
+    auto control = networkControl.createMemoryControlUnit("main");
+    control->insert({dynamicRegion(0, 1, 0, 4096), dynamicRegion(2, 3, 1, 1024)}, {});
+    auto solution = control->solve();
+    control->allocateMemory();
+
+    for (const auto& [id, block] : solution) {
+        ASSERT_NE(block->getRawPtr(), nullptr);
+        EXPECT_FALSE(block->resize(1024));
+    }
+    EXPECT_FALSE(solution.at(0)->resize(4096));
+    EXPECT_EQ(control->getArenaStatistics().reallocations, 0);
+
+    control->releaseMemory();
+    control->allocateMemory();
+    EXPECT_FALSE(solution.at(0)->resize(4096));
+    EXPECT_EQ(control->getArenaStatistics().reallocations, 0);
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <string>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
@@ -380,3 +382,284 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, LruPolicy) {
+    // small caches are kept in a single shard, so the exact LRU policy applies
+    constexpr int capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.size(), static_cast<size_t>(capacity));
+    ASSERT_EQ(cache.getEvictions(), static_cast<size_t>(3));
+}
+
+TEST(ShardedLruCacheTests, Capacity) {
+    constexpr int capacity = 4096;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 4 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    constexpr auto maxShards = ShardedLruCache<IntKey, int>::maxShards;
+    ASSERT_LE(cache.size(), static_cast<size_t>(capacity) + maxShards);
+    ASSERT_EQ(cache.size() + cache.getEvictions(), static_cast<size_t>(4 * capacity));
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.misses, static_cast<size_t>(2 * capacity));
+    ASSERT_EQ(stats.evictions, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.entries, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 1024;
+    constexpr int keys = 2 * capacity;
+    constexpr size_t numThreads = 16;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, true);
+
+    auto testRoutine = [&](size_t threadId) {
+        for (int i = 0; i < keys; ++i) {
+            const int key = static_cast<int>((i + threadId * 7) % keys);
+            auto intResult = cache.getOrCreate(IntKey{key}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, key);
+            auto strResult = cache.getOrCreate(StringKey{std::to_string(key)}, strBuilder);
+            ASSERT_NE(strResult.first, StrValueType());
+            ASSERT_EQ(*strResult.first, std::to_string(key));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, 2 * numThreads * keys);
+    constexpr auto maxShards = ShardedLruCache<IntKey, int>::maxShards;
+    ASSERT_LE(stats.entries, 2 * static_cast<size_t>(capacity + maxShards));
+}
+
+namespace {
+struct ThreadSafeValue {
+    explicit ThreadSafeValue(int data) : data(data) {}
+    static constexpr bool threadSafeCacheValue = true;
+    int data;
+};
+}  // namespace
+
+TEST(MultiCacheTests, OnlyThreadSafeValuesAreShared) {
+    constexpr int capacity = 10;
+    static_assert(IsThreadSafeCacheValue<std::shared_ptr<ThreadSafeValue>>::value);
+    static_assert(!IsThreadSafeCacheValue<std::shared_ptr<int>>::value);
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity, true);
+    MultiCache streamCache0(capacity, sharedCache);
+    MultiCache streamCache1(capacity, sharedCache);
+
+    auto safeBuilder = [&](const IntKey& key) {
+        return std::make_shared<ThreadSafeValue>(key.data);
+    };
+    auto unsafeBuilder = [&](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    auto safe0 = streamCache0.getOrCreate(IntKey{1}, safeBuilder);
+    auto safe1 = streamCache1.getOrCreate(IntKey{1}, safeBuilder);
+    ASSERT_EQ(safe1.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(safe0.first, safe1.first);
+
+    auto unsafe0 = streamCache0.getOrCreate(IntKey{1}, unsafeBuilder);
+    auto unsafe1 = streamCache1.getOrCreate(IntKey{1}, unsafeBuilder);
+    ASSERT_EQ(unsafe1.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(unsafe0.first, unsafe1.first);
+
+    ASSERT_EQ(sharedCache->getStatistics().entries, static_cast<size_t>(1));
+    ASSERT_EQ(streamCache0.getStatistics().entries, static_cast<size_t>(1));
+    ASSERT_EQ(streamCache1.getStatistics().entries, static_cast<size_t>(1));
+}
+
+TEST(MultiCacheTests, StatisticsPerType) {
+    constexpr int capacity = 10;
+    MultiCache cache(capacity);
+
+    // the entries share the key type, so they must be told apart by the value type
+    auto intBuilder = [&](const IntKey& key) {
+        return key.data + 1;
+    };
+    auto stringBuilder = [&](const IntKey& key) {
+        return std::to_string(key.data);
+    };
+    for (int i = 0; i < 3; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    cache.getOrCreate(IntKey{0}, intBuilder);
+    cache.getOrCreate(IntKey{0}, stringBuilder);
+
+    auto perType = cache.getStatisticsPerType();
+    ASSERT_EQ(perType.size(), static_cast<size_t>(2));
+    size_t hits = 0;
+    size_t misses = 0;
+    for (const auto& item : perType) {
+        hits += item.second.hits;
+        misses += item.second.misses;
+    }
+    ASSERT_EQ(hits, static_cast<size_t>(1));
+    ASSERT_EQ(misses, static_cast<size_t>(4));
+}
+
+namespace {
+struct CostlyValue {
+    explicit CostlyValue(size_t cost) : cost(cost) {}
+    size_t cacheCost() const {
+        return cost;
+    }
+
+    size_t cost;
+};
+}  // namespace
+
+TEST(LruCacheTests, Bytes) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i, 100));
+    }
+    ASSERT_EQ(cache.getBytes(), static_cast<size_t>(100 * capacity));
+
+    // rewriting a record replaces its cost
+    OV_ASSERT_NO_THROW(cache.put({0}, 0, 10));
+    ASSERT_EQ(cache.getBytes(), static_cast<size_t>(100 * (capacity - 1) + 10));
+
+    OV_ASSERT_NO_THROW(cache.evict(2));
+    ASSERT_EQ(cache.getBytes(), static_cast<size_t>(100 * (capacity - 3) + 10));
+}
+
+TEST(MultiCacheTests, ByteBudget) {
+    constexpr int capacity = 100;
+    constexpr size_t budget = 1000;
+
+    auto bigBuilder = [&](const IntKey&) {
+        return std::make_shared<CostlyValue>(300);
+    };
+    auto smallBuilder = [&](const StringKey&) {
+        return std::make_shared<CostlyValue>(50);
+    };
+    auto hugeBuilder = [&](const IntKey&) {
+        return std::make_shared<CostlyValue>(2 * budget);
+    };
+
+    for (bool threadSafe : {false, true}) {
+        MultiCache cache(capacity, threadSafe, budget);
+        for (int i = 0; i < 3; ++i) {
+            cache.getOrCreate(IntKey{i}, bigBuilder);
+        }
+        ASSERT_EQ(cache.getBytes(), static_cast<size_t>(900));
+        ASSERT_EQ(cache.getOrCreate(IntKey{0}, bigBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+
+        // the least recently used record is evicted whatever its type is, so the big record 1 goes first
+        for (int i = 0; i < 3; ++i) {
+            cache.getOrCreate(StringKey{std::to_string(i)}, smallBuilder);
+        }
+        auto stats = cache.getStatistics();
+        ASSERT_EQ(stats.bytes, static_cast<size_t>(750));
+        ASSERT_EQ(stats.evictions, static_cast<size_t>(1));
+        ASSERT_EQ(cache.getOrCreate(IntKey{0}, bigBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_EQ(cache.getOrCreate(StringKey{"0"}, smallBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_EQ(cache.getOrCreate(IntKey{1}, bigBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+
+        size_t bytes = 0;
+        for (const auto& item : cache.getStatisticsPerType()) {
+            bytes += item.second.bytes;
+        }
+        ASSERT_EQ(bytes, cache.getBytes());
+        ASSERT_LE(bytes, budget);
+
+        // a single record exceeding the budget is still returned and kept
+        auto result = cache.getOrCreate(IntKey{100}, hugeBuilder);
+        ASSERT_EQ(result.first->cost, 2 * budget);
+        ASSERT_EQ(cache.getStatistics().entries, static_cast<size_t>(1));
+        ASSERT_EQ(cache.getOrCreate(IntKey{100}, hugeBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
+
+namespace {
+struct SharedCostlyValue : CostlyValue {
+    using CostlyValue::CostlyValue;
+    static constexpr bool threadSafeCacheValue = true;
+};
+}  // namespace
+
+TEST(MultiCacheTests, SharedByteBudget) {
+    constexpr int capacity = 1024;
+    constexpr int keys = 256;
+    constexpr size_t cost = 100;
+    constexpr size_t budget = 10 * cost;
+    constexpr size_t numThreads = 8;
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity, true, budget);
+    auto builder = [&](const IntKey&) {
+        return std::make_shared<SharedCostlyValue>(cost);
+    };
+
+    auto testRoutine = [&](size_t threadId) {
+        MultiCache streamCache(capacity, sharedCache, budget);
+        for (int i = 0; i < keys; ++i) {
+            const int key = static_cast<int>((i + threadId * 7) % keys);
+            auto result = streamCache.getOrCreate(IntKey{key}, builder);
+            ASSERT_NE(result.first, nullptr);
+            ASSERT_EQ(result.first->cost, cost);
+        }
+        // the values are held by the shared cache only
+        ASSERT_EQ(streamCache.getStatistics().entries, static_cast<size_t>(0));
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    const auto stats = sharedCache->getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * keys);
+    ASSERT_LE(stats.bytes, budget);
+    ASSERT_EQ(stats.bytes, stats.entries * cost);
+}
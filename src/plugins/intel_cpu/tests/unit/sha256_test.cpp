@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+#include "utils/sha256.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::string sha256Hex(const std::string& data) {
+    return Sha256::toHex(Sha256::digest(data.data(), data.size()));
+}
+
+}  // namespace
+
+// the test vectors of FIPS 180-4 examples
+TEST(Sha256Tests, KnownDigests) {
+    ASSERT_EQ(sha256Hex(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    ASSERT_EQ(sha256Hex("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    ASSERT_EQ(sha256Hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    ASSERT_EQ(sha256Hex(std::string(1000000, 'a')), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST(Sha256Tests, IncrementalUpdate) {
+    std::string data;
+    for (size_t i = 0; i < 1000; ++i) {
+        data.push_back(static_cast<char>(i * 31 + 7));
+    }
+    // the pieces cross the block boundaries at different offsets
+    for (size_t piece : {1, 7, 55, 56, 63, 64, 65, 200}) {
+        Sha256 sha;
+        for (size_t offset = 0; offset < data.size(); offset += piece) {
+            sha.update(data.data() + offset, std::min(piece, data.size() - offset));
+        }
+        ASSERT_EQ(Sha256::toHex(sha.finalize()), sha256Hex(data)) << "piece size " << piece;
+    }
+}
@@ -0,0 +1,268 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#if !defined(_WIN32)
+
+#    include "shared_weights_storage.hpp"
+
+#    include <gtest/gtest.h>
+
+#    include <sys/stat.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
+
+#    include <cstdint>
+#    include <cstring>
+#    include <filesystem>
+#    include <fstream>
+#    include <memory>
+#    include <oneapi/dnnl/dnnl.hpp>
+#    include <string>
+
+#    include "common_test_utils/common_utils.hpp"
+#    include "cpu_memory.h"
+#    include "cpu_shape.h"
+#    include "memory_desc/cpu_blocked_memory_desc.h"
+#    include "openvino/core/type/element_type.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+class SharedWeightsStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_storageDir = (std::filesystem::temp_directory_path() /
+                        ("ov_cpu_shared_weights_" + ov::test::utils::generateTestFilePrefix()))
+                           .string();
+        m_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{1024});
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_storageDir);
+    }
+
+    MemoryPtr create() {
+        ++m_creations;
+        auto memory = std::make_shared<Memory>(m_eng, m_desc);
+        std::memset(memory->getData(), 0x5a, memory->getSize());
+        return memory;
+    }
+
+    [[nodiscard]] std::string recordPath() const {
+        return (std::filesystem::path(m_storageDir) / "weights_0.bin").string();
+    }
+
+    [[nodiscard]] size_t recordsNum() const {
+        size_t result = 0;
+        for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator(m_storageDir)) {
+            ++result;
+        }
+        return result;
+    }
+
+    std::string m_storageDir;
+    dnnl::engine m_eng{dnnl::engine::kind::cpu, 0};
+    MemoryDescPtr m_desc;
+    size_t m_creations = 0;
+};
+}  // namespace
+
+TEST_F(SharedWeightsStorageTest, Disabled) {
+    ASSERT_EQ(SharedWeightsStorage::create("", 0), nullptr);
+}
+
+TEST_F(SharedWeightsStorageTest, FindOrCreate) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0);
+    auto first = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    auto second = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 1);
+    ASSERT_EQ(second->getSize(), m_desc->getCurrentMemSize());
+    const auto* data = second->getDataAs<const uint8_t>();
+    for (size_t i = 0; i < second->getSize(); ++i) {
+        ASSERT_EQ(data[i], 0x5a);
+    }
+    ASSERT_EQ(recordsNum(), 1);
+}
+
+TEST_F(SharedWeightsStorageTest, RecordPerSocket) {
+    auto socket0 = SharedWeightsStorage::create(m_storageDir, 0);
+    auto socket1 = SharedWeightsStorage::create(m_storageDir, 1);
+    auto first = socket0->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    auto second = socket1->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 2);
+    ASSERT_EQ(recordsNum(), 2);
+}
+
+TEST_F(SharedWeightsStorageTest, RemovedByLastUser) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0);
+    auto first = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    auto second = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    first.reset();
+    ASSERT_EQ(recordsNum(), 1);
+    second.reset();
+    ASSERT_EQ(recordsNum(), 0);
+
+    auto third = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 2);
+}
+
+TEST_F(SharedWeightsStorageTest, Persistent) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0, true);
+    auto first = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    first.reset();
+    ASSERT_EQ(recordsNum(), 1);
+
+    // the released record is reused by a storage created later, e.g. in the next process
+    auto other = SharedWeightsStorage::create(m_storageDir, 0, true);
+    auto second = other->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 1);
+    ASSERT_EQ(second->getDataAs<const uint8_t>()[0], 0x5a);
+}
+
+TEST_F(SharedWeightsStorageTest, SizeMismatch) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0);
+    auto first = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    // a record of another size is never mapped, the private copy is used instead
+    auto otherDesc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{2048});
+    auto second = storage->findOrCreate("weights", m_eng, otherDesc, [this, &otherDesc]() {
+        ++m_creations;
+        return std::make_shared<Memory>(m_eng, otherDesc);
+    });
+    ASSERT_EQ(m_creations, 2);
+    ASSERT_EQ(second->getSize(), otherDesc->getCurrentMemSize());
+}
+
+TEST_F(SharedWeightsStorageTest, PersistentSizeBound) {
+    const size_t recordSize = 64 + m_desc->getCurrentMemSize();
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0, true, 2 * recordSize);
+    auto first = storage->findOrCreate("first", m_eng, m_desc, [this]() {
+        return create();
+    });
+    storage->findOrCreate("second", m_eng, m_desc, [this]() {
+        return create();
+    });
+    storage->findOrCreate("third", m_eng, m_desc, [this]() {
+        return create();
+    });
+    // the mapped record cannot be removed, so the least recently used one of the released records is evicted
+    ASSERT_EQ(recordsNum(), 2);
+    ASSERT_TRUE(std::filesystem::exists(std::filesystem::path(m_storageDir) / "first_0.bin"));
+    ASSERT_FALSE(std::filesystem::exists(std::filesystem::path(m_storageDir) / "second_0.bin"));
+
+    // the record does not fit while both the records are mapped, so the private copy is used
+    auto third = storage->findOrCreate("third", m_eng, m_desc, [this]() {
+        return create();
+    });
+    auto fourth = storage->findOrCreate("fourth", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 4);
+    ASSERT_EQ(fourth->getDataAs<const uint8_t>()[0], 0x5a);
+    ASSERT_EQ(recordsNum(), 2);
+
+    auto small = SharedWeightsStorage::create(m_storageDir, 0, true, recordSize - 1);
+    small->findOrCreate("fifth", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(recordsNum(), 2);
+}
+
+TEST_F(SharedWeightsStorageTest, UntrustedRecord) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0, true);
+    storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    // a record writable by the others is neither mapped nor removed
+    ASSERT_EQ(chmod(recordPath().c_str(), S_IRUSR | S_IWUSR | S_IWOTH), 0);
+    auto second = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 2);
+    ASSERT_EQ(second->getDataAs<const uint8_t>()[0], 0x5a);
+    ASSERT_EQ(recordsNum(), 1);
+}
+
+TEST_F(SharedWeightsStorageTest, CorruptedRecord) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0, true);
+    storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    {
+        std::fstream record(recordPath(), std::ios::in | std::ios::out | std::ios::binary);
+        record.seekp(64 + 100);
+        record.put(0);
+    }
+    // the record fails the hash check, so it is replaced with a new one
+    auto second = storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 2);
+    ASSERT_EQ(second->getDataAs<const uint8_t>()[100], 0x5a);
+    ASSERT_EQ(recordsNum(), 1);
+
+    auto other = SharedWeightsStorage::create(m_storageDir, 0, true);
+    auto third = other->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    ASSERT_EQ(m_creations, 2);
+}
+
+TEST_F(SharedWeightsStorageTest, RecordOfAnotherKey) {
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0, true);
+    storage->findOrCreate("weights", m_eng, m_desc, [this]() {
+        return create();
+    });
+    const auto otherPath = (std::filesystem::path(m_storageDir) / "other_0.bin").string();
+    std::filesystem::copy_file(recordPath(), otherPath);
+    // the record header holds the digest of its key, so the copy is not mapped under another key
+    auto second = storage->findOrCreate("other", m_eng, m_desc, [this]() {
+        ++m_creations;
+        auto memory = std::make_shared<Memory>(m_eng, m_desc);
+        std::memset(memory->getData(), 0x3c, memory->getSize());
+        return memory;
+    });
+    ASSERT_EQ(m_creations, 2);
+    ASSERT_EQ(second->getDataAs<const uint8_t>()[0], 0x3c);
+}
+
+TEST_F(SharedWeightsStorageTest, StaleTmpFilesRemoved) {
+    const auto deadPid = fork();
+    ASSERT_GE(deadPid, 0);
+    if (deadPid == 0) {
+        _exit(0);
+    }
+    ASSERT_EQ(waitpid(deadPid, nullptr, 0), deadPid);
+
+    std::filesystem::create_directories(m_storageDir);
+    const auto stale = recordPath() + "." + std::to_string(deadPid) + ".0.tmp";
+    const auto alive = recordPath() + "." + std::to_string(getpid()) + ".0.tmp";
+    std::ofstream(stale).put(0);
+    std::ofstream(alive).put(0);
+
+    auto storage = SharedWeightsStorage::create(m_storageDir, 0);
+    ASSERT_FALSE(std::filesystem::exists(stale));
+    ASSERT_TRUE(std::filesystem::exists(alive));
+}
+
+#endif  // !defined(_WIN32)
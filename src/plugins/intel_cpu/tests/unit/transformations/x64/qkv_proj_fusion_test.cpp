@@ -4,7 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/test_common.hpp"
@@ -17,6 +19,8 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 
 using namespace testing;
@@ -83,4 +87,143 @@ TEST_F(TransformationTestsF, QKVProjFusion1Test) {
         auto v_proj = std::make_shared<v0::Result>(qkv_proj->output(2));
         model_ref = std::make_shared<ov::Model>(OutputVector{q_proj, k_proj, v_proj}, ParameterVector{input_param});
     }
-}
\ No newline at end of file
+}
+TEST_F(TransformationTestsF, QKVProjFusion1PerOCCompressedTest) {
+    disable_rt_info_check();
+    disable_result_friendly_names_check();
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+
+    size_t hidden_size = 256;
+    std::vector<size_t> proj_sizes = {256, 64, 64};
+    // u8 weights with the zero point 128 and the unit scales are dequantized to [-128, 127] in each row, so they are
+    // shifted to i8 exactly
+    auto get_weights = [&](size_t proj_size) {
+        std::vector<uint8_t> weights(proj_size * hidden_size);
+        for (size_t i = 0; i < weights.size(); i++) {
+            weights[i] = static_cast<uint8_t>((i / hidden_size + i) % 256);
+        }
+        return weights;
+    };
+    {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        OutputVector projs;
+        for (auto proj_size : proj_sizes) {
+            auto weight_const =
+                std::make_shared<v0::Constant>(element::u8, Shape{proj_size, hidden_size}, get_weights(proj_size));
+            auto weight_cvt = std::make_shared<v0::Convert>(weight_const, element::f16);
+            auto zp_const = v0::Constant::create(element::u8, Shape{proj_size, 1}, {128});
+            auto zp_cvt = std::make_shared<v0::Convert>(zp_const, element::f16);
+            auto weight_sub = std::make_shared<v1::Subtract>(weight_cvt, zp_cvt);
+            auto scales = v0::Constant::create(element::f16, Shape{proj_size, 1}, {1.0f});
+            auto weight_deq = std::make_shared<v1::Multiply>(weight_sub, scales);
+            auto weight_f32 = std::make_shared<v0::Convert>(weight_deq, element::f32);
+            projs.push_back(std::make_shared<v0::MatMul>(input_param, weight_f32, false, true));
+        }
+
+        model = std::make_shared<ov::Model>(projs, ParameterVector{input_param});
+        manager.register_pass<ov::intel_cpu::QKVProjFusion>();
+        manager.get_pass_config()->set_callback<ov::intel_cpu::QKVProjFusionPass1>(
+            [=](const std::shared_ptr<const ov::Node>) -> bool {
+                return true;
+            });
+    }
+    {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        OutputVector args{input_param};
+        OutputVector scales;
+        for (auto proj_size : proj_sizes) {
+            std::vector<int8_t> weights_i8;
+            for (auto w : get_weights(proj_size)) {
+                weights_i8.push_back(static_cast<int8_t>(w - 128));
+            }
+            args.push_back(std::make_shared<v0::Constant>(element::i8, Shape{proj_size, hidden_size}, weights_i8));
+            scales.push_back(v0::Constant::create(element::f32, Shape{proj_size, 1}, {1.0f}));
+        }
+        args.insert(args.end(), scales.begin(), scales.end());
+
+        intel_cpu::QKVProjectionNode::Config config{true,
+                                                    static_cast<int>(hidden_size),
+                                                    static_cast<int>(proj_sizes[0]),
+                                                    static_cast<int>(proj_sizes[1]),
+                                                    static_cast<int>(proj_sizes[2]),
+                                                    false};
+        auto qkv_proj = std::make_shared<intel_cpu::QKVProjectionNode>(args, config);
+
+        auto q_proj = std::make_shared<v0::Result>(qkv_proj->output(0));
+        auto k_proj = std::make_shared<v0::Result>(qkv_proj->output(1));
+        auto v_proj = std::make_shared<v0::Result>(qkv_proj->output(2));
+        model_ref = std::make_shared<ov::Model>(OutputVector{q_proj, k_proj, v_proj}, ParameterVector{input_param});
+    }
+}
+
+// the weights 255 shifted by the zero point 127 don't fit into i8, so they are not fused rather than rounded again
+TEST_F(TransformationTestsF, QKVProjFusion1PerOCCompressedOutOfRangeNotFusedTest) {
+    disable_rt_info_check();
+    disable_result_friendly_names_check();
+
+    size_t hidden_size = 256;
+    std::vector<size_t> proj_sizes = {256, 64, 64};
+    {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        OutputVector projs;
+        for (auto proj_size : proj_sizes) {
+            auto weight_const = v0::Constant::create(element::u8, Shape{proj_size, hidden_size}, {255});
+            auto weight_cvt = std::make_shared<v0::Convert>(weight_const, element::f16);
+            auto zp_const = v0::Constant::create(element::u8, Shape{proj_size, 1}, {127});
+            auto zp_cvt = std::make_shared<v0::Convert>(zp_const, element::f16);
+            auto weight_sub = std::make_shared<v1::Subtract>(weight_cvt, zp_cvt);
+            auto scales = v0::Constant::create(element::f16, Shape{proj_size, 1}, {1.0f});
+            auto weight_deq = std::make_shared<v1::Multiply>(weight_sub, scales);
+            auto weight_f32 = std::make_shared<v0::Convert>(weight_deq, element::f32);
+            projs.push_back(std::make_shared<v0::MatMul>(input_param, weight_f32, false, true));
+        }
+
+        model = std::make_shared<ov::Model>(projs, ParameterVector{input_param});
+        manager.register_pass<ov::intel_cpu::QKVProjFusion>();
+        manager.get_pass_config()->set_callback<ov::intel_cpu::QKVProjFusionPass1>(
+            [=](const std::shared_ptr<const ov::Node>) -> bool {
+                return true;
+            });
+    }
+}
+
+// the per OC i8 kernels can't keep the group scales, so the group-wise compressed weights are not fused
+TEST_F(TransformationTestsF, QKVProjFusion1GroupwiseCompressedNotFusedTest) {
+    disable_rt_info_check();
+    disable_result_friendly_names_check();
+
+    size_t hidden_size = 256;
+    size_t group_size = 32;
+    std::vector<size_t> proj_sizes = {256, 64, 64};
+    {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        OutputVector projs;
+        for (auto proj_size : proj_sizes) {
+            const Shape groups_shape{proj_size, hidden_size / group_size, 1};
+            auto weight_const = v0::Constant::create(element::u4,
+                                                     Shape{proj_size, hidden_size / group_size, group_size},
+                                                     {3});
+            auto weight_cvt = std::make_shared<v0::Convert>(weight_const, element::f16);
+            auto zp_const = v0::Constant::create(element::u4, groups_shape, {8});
+            auto zp_cvt = std::make_shared<v0::Convert>(zp_const, element::f16);
+            auto weight_sub = std::make_shared<v1::Subtract>(weight_cvt, zp_cvt);
+            auto scales = v0::Constant::create(element::f16, groups_shape, {1.0f});
+            auto weight_deq = std::make_shared<v1::Multiply>(weight_sub, scales);
+            auto weight_shape = v0::Constant::create(element::i64, Shape{2}, {proj_size, hidden_size});
+            auto weight_reshape = std::make_shared<v1::Reshape>(weight_deq, weight_shape, false);
+            auto weight_f32 = std::make_shared<v0::Convert>(weight_reshape, element::f32);
+            projs.push_back(std::make_shared<v0::MatMul>(input_param, weight_f32, false, true));
+        }
+
+        model = std::make_shared<ov::Model>(projs, ParameterVector{input_param});
+        manager.register_pass<ov::intel_cpu::QKVProjFusion>();
+        manager.get_pass_config()->set_callback<ov::intel_cpu::QKVProjFusionPass1>(
+            [=](const std::shared_ptr<const ov::Node>) -> bool {
+                return true;
+            });
+    }
+}